@@ -19,6 +19,21 @@ juce::File getLegacyDefaultsFilePath()
     return getConfigDirectory().getChildFile("defaults.json");
 }
 
+struct ParsedDefaultsCache
+{
+    juce::CriticalSection lock;
+    DefaultsPersistence::ParsedDocument document;
+    juce::File file;
+    juce::Time modified;
+    juce::int64 size = -1;
+};
+
+ParsedDefaultsCache& getParsedDefaultsCache()
+{
+    static ParsedDefaultsCache cache;
+    return cache;
+}
+
 bool isValidJsonDocument(const juce::String& json)
 {
     return !json.isEmpty() && !juce::JSON::parse(json).isVoid();
@@ -112,7 +127,11 @@ juce::File DefaultsPersistence::getFailureLogFile()
 
 bool DefaultsPersistence::saveUser(const juce::String& json, juce::String* outError)
 {
-    return writeJsonDocument(getUserDefaultsFile(), json, outError, true);
+    // mtime granularity can be a full second, so never rely on it for our own writes.
+    invalidateParsedCache();
+    const bool ok = writeJsonDocument(getUserDefaultsFile(), json, outError, true);
+    invalidateParsedCache();
+    return ok;
 }
 
 juce::String DefaultsPersistence::loadUser(juce::String* outError)
@@ -226,6 +245,57 @@ juce::String DefaultsPersistence::load(juce::String* outError)
     return loadUser(outError);
 }
 
+DefaultsPersistence::ParsedDocument DefaultsPersistence::loadParsed()
+{
+    return loadParsedFrom(getUserDefaultsFile());
+}
+
+DefaultsPersistence::ParsedDocument DefaultsPersistence::loadParsedFrom(const juce::File& file)
+{
+    auto& cache = getParsedDefaultsCache();
+
+    // Held across the parse so concurrent constructors wait for one parse instead of racing.
+    const juce::ScopedLock lock(cache.lock);
+    const bool existsBefore = file.existsAsFile();
+    const auto modifiedBefore = file.getLastModificationTime();
+    const auto sizeBefore = file.getSize();
+    if (cache.document != nullptr && existsBefore && cache.file == file
+        && cache.modified == modifiedBefore && cache.size == sizeBefore)
+        return cache.document;
+
+    cache.document.reset();
+    // The user sheet goes through loadUser() for the legacy migration.
+    const auto json = file == getUserDefaultsFile() ? loadUser() : file.loadFileAsString();
+    if (json.isEmpty())
+        return nullptr;
+
+    auto parsed = juce::JSON::parse(json);
+    if (parsed.getDynamicObject() == nullptr)
+        return nullptr;
+
+    auto document = std::make_shared<const juce::var>(std::move(parsed));
+
+    // Only cache when the file did not change underneath the read (legacy migration writes it too).
+    const auto modifiedAfter = file.getLastModificationTime();
+    const auto sizeAfter = file.getSize();
+    if (existsBefore && modifiedAfter == modifiedBefore && sizeAfter == sizeBefore)
+    {
+        cache.document = document;
+        cache.file = file;
+        cache.modified = modifiedAfter;
+        cache.size = sizeAfter;
+    }
+    return document;
+}
+
+void DefaultsPersistence::invalidateParsedCache()
+{
+    auto& cache = getParsedDefaultsCache();
+    const juce::ScopedLock lock(cache.lock);
+    cache.document.reset();
+    cache.size = -1;
+}
+
 void DefaultsPersistence::logFailure(const juce::String& reason)
 {
     const auto now = juce::Time::getCurrentTime().toString(true, true, true, true);
@@ -6,10 +6,14 @@
 #pragma once
 
 #include <juce_core/juce_core.h>
+#include <memory>
 
 /** Handles read/write of defaults.json and recovery files. No UI, no DSP. */
 struct DefaultsPersistence
 {
+    /** Parsed defaults document. Immutable once published; shared by every plugin instance. */
+    using ParsedDocument = std::shared_ptr<const juce::var>;
+
     static juce::File getUserDefaultsFile();
     static juce::File getFactoryDefaultsFile();
 
@@ -35,6 +39,17 @@ struct DefaultsPersistence
     /** Read defaults file. Returns empty string on failure. */
     static juce::String load(juce::String* outError = nullptr);
 
+    /**
+     * Parsed user defaults from a process-wide cache keyed by the file's mtime and size.
+     * The first caller parses; later callers share the same document until the file changes
+     * or saveUser() invalidates it. Returns nullptr when no valid defaults exist.
+     */
+    static ParsedDocument loadParsed();
+    /** As loadParsed(), for an explicit file (tests point the cache at a scratch file). */
+    static ParsedDocument loadParsedFrom(const juce::File& file);
+    /** Drop the cached document so the next loadParsed() re-reads the file. */
+    static void invalidateParsedCache();
+
     /** Append a failure line to the log (for diagnostics). */
     static void logFailure(const juce::String& reason);
 };
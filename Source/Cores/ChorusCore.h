@@ -43,10 +43,79 @@ public:
     // block: Audio block to process
     // currentCentreDelayMs: Current centre delay in milliseconds
     virtual void processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs) = 0;
+
+    // Channel-parallel rendering (large offline blocks only)
+    // Cores whose per-channel state is fully independent split processDelay into a serial
+    // per-block prelude and a per-channel body; ChorusDSP may then run the channel bodies
+    // concurrently. The prelude must hold every write to state shared between channels.
+    virtual bool supportsChannelParallelism() const { return false; }
+    virtual void beginDelayBlock(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
+    {
+        juce::ignoreUnused(dsp, block, currentCentreDelayMs);
+    }
+    virtual void processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel)
+    {
+        juce::ignoreUnused(dsp, block, currentCentreDelayMs, channel);
+    }
     
+    // Shared input history
+    // Cores that only delay the dry input read it from ChorusDSP's input-history ring instead of
+    // keeping a private one; return the history they need behind the write head (interpolation
+    // taps included). Such a core has valid history the moment it is switched in, so it skips
+    // the switch warmup. resumeFromSharedHistory() runs right before it becomes audible again and
+    // should drop modulation state left over from its last use.
+    virtual int getSharedHistorySamples() const { return 0; }
+    bool readsSharedHistory() const { return getSharedHistorySamples() > 0; }
+    virtual void resumeFromSharedHistory() {}
+
     // Get the guard samples needed for this interpolation type
     virtual float getGuardSamples() const = 0;
     
     // Get the maximum delay in samples (for clamping)
     virtual float getMaxDelaySamples() const = 0;
+
+protected:
+    // Mono and stereo get a process loop specialised on the channel count at compile time,
+    // chosen once in prepare(). Any other block shape takes the generic per-channel path.
+    enum class ChannelLayout
+    {
+        generic,
+        mono,
+        stereo
+    };
+
+    static ChannelLayout channelLayoutFor(juce::uint32 numChannels) noexcept
+    {
+        if (numChannels == 1)
+            return ChannelLayout::mono;
+        if (numChannels == 2)
+            return ChannelLayout::stereo;
+        return ChannelLayout::generic;
+    }
+
+    // 4-point (3rd order) Lagrange read from a power-of-two ring buffer.
+    // Green HQ (Lagrange 5th) falls back to this when the CPU governor reduces interpolation quality.
+    static float readLagrange3rd(const float* buffer, int bufferMask, int writePos, float delaySamples)
+    {
+        float readPos = static_cast<float>(writePos) - delaySamples;
+        while (readPos < 0.0f)
+            readPos += static_cast<float>(bufferMask + 1);
+
+        const int i0 = static_cast<int>(readPos);
+        const float u = readPos - static_cast<float>(i0);
+
+        const float xm1 = buffer[(i0 - 1) & bufferMask];
+        const float x0 = buffer[i0 & bufferMask];
+        const float x1 = buffer[(i0 + 1) & bufferMask];
+        const float x2 = buffer[(i0 + 2) & bufferMask];
+
+        const float um1 = u - 1.0f;
+        const float um2 = u - 2.0f;
+        const float up1 = u + 1.0f;
+        const float cm1 = -u * um1 * um2 * (1.0f / 6.0f);
+        const float c0 = up1 * um1 * um2 * 0.5f;
+        const float c1 = -up1 * u * um2 * 0.5f;
+        const float c2 = up1 * u * um1 * (1.0f / 6.0f);
+        return cm1 * xm1 + c0 * x0 + c1 * x1 + c2 * x2;
+    }
 };
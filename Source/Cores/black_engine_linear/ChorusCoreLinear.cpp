@@ -90,13 +90,10 @@ void ChorusCoreLinear::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>
         lastDelayGlideMs = delayGlideMs;
     }
 
-    auto* lfoLeft = dsp.lfoBuffer.getReadPointer(0);
-    auto* lfoRight = (numChannels >= 2) ? dsp.cosBuffer.getReadPointer(0) : lfoLeft;
-
     for (int ch = 0; ch < numChannels; ++ch)
     {
         auto* channelSamples = block.getChannelPointer(ch);
-        const float* channelLfo = (ch == 0) ? lfoLeft : lfoRight;
+        const float* channelLfo = dsp.getChannelLfo(ch);
 
         for (int i = 0; i < blockNumSamples; ++i)
         {
@@ -63,9 +63,6 @@ void ChorusCoreLinearEnsemble::processDelay(ChorusDSP& dsp, juce::dsp::AudioBloc
     const float centreDelaySamples = currentCentreDelayMs * spec.sampleRate / 1000.0f;
     const float depthSamples = maximumDelayModulation * spec.sampleRate / 1000.0f;
 
-    auto* lfoLeft = dsp.lfoBuffer.getReadPointer(0);
-    auto* lfoRight = (numChannels >= 2) ? dsp.cosBuffer.getReadPointer(0) : lfoLeft;
-
     const auto& tuning = dsp.runtimeTuningSnapshot;
     const float colour = juce::jlimit(0.0f, 1.0f, dsp.smoothedColor.getCurrentValue());
     // In Black HQ mode, Color controls modulation intensity and ensemble spread.
@@ -80,8 +77,8 @@ void ChorusCoreLinearEnsemble::processDelay(ChorusDSP& dsp, juce::dsp::AudioBloc
     for (int ch = 0; ch < numChannels; ++ch)
     {
         auto* channelSamples = block.getChannelPointer(ch);
-        const float* primaryLfo = (ch == 0) ? lfoLeft : lfoRight;
-        const float* oppositeLfo = (ch == 0) ? lfoRight : lfoLeft;
+        const float* primaryLfo = dsp.getChannelLfo(ch);
+        const float* oppositeLfo = dsp.getChannelPartnerLfo(ch);
 
         for (int i = 0; i < blockNumSamples; ++i)
         {
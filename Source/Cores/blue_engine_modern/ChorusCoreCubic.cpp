@@ -20,6 +20,7 @@
 #include "../../DSP/ChorusDSP.h"
 #include <cmath>
 #include <algorithm>
+#include <array>
 
 ChorusCoreCubic::ChorusCoreCubic()
 {
@@ -28,6 +29,7 @@ ChorusCoreCubic::ChorusCoreCubic()
 void ChorusCoreCubic::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusDSP*)
 {
     spec = processSpec;
+    channelLayout = channelLayoutFor(spec.numChannels);
 
     // Calculate maximum delay needed
     constexpr float maximumDelayModulation = 20.0f;
@@ -40,28 +42,12 @@ void ChorusCoreCubic::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusD
         (maximumDelayModulation * maxDepth * oscVolumeMultiplier + maxCentreDelayMs)
         * spec.sampleRate / 1000.0)) + guardMarginSamples;
     
-    // Round up to next power of 2 for efficient masking
-    bufferSize = 1;
-    while (bufferSize < maxDelaySamples + 4) // +4 for cubic interpolation
-        bufferSize <<= 1;
-    bufferMask = bufferSize - 1;
-    
-    // Allocate buffers for each channel
-    delayBuffers.resize(static_cast<size_t>(spec.numChannels));
-    writePositions.resize(static_cast<size_t>(spec.numChannels));
-    
-    for (size_t ch = 0; ch < delayBuffers.size(); ++ch)
-    {
-        delayBuffers[ch].assign(static_cast<size_t>(bufferSize), 0.0f);
-        writePositions[ch] = 0;
-    }
+    historySamples = maxDelaySamples + 4; // +4 for cubic interpolation
 }
 
 void ChorusCoreCubic::reset()
 {
-    for (auto& buffer : delayBuffers)
-        std::fill(buffer.begin(), buffer.end(), 0.0f);
-    std::fill(writePositions.begin(), writePositions.end(), 0);
+    // Stateless apart from the shared input history, which ChorusDSP clears.
 }
 
 float ChorusCoreCubic::getMaxDelaySamples() const
@@ -69,27 +55,24 @@ float ChorusCoreCubic::getMaxDelaySamples() const
     return static_cast<float>(maxDelaySamples) - getGuardSamples();
 }
 
-float ChorusCoreCubic::readCubic(int channel, float delaySamples) const
+float ChorusCoreCubic::readCubic(const float* buf, int bufMask, int writePos, float delaySamples)
 {
-    const auto& buf = delayBuffers[static_cast<size_t>(channel)];
-    const int writePos = writePositions[static_cast<size_t>(channel)];
-    
     // Calculate read position (behind write head)
     float readPos = static_cast<float>(writePos) - delaySamples;
     
     // Wrap to positive range
     while (readPos < 0.0f)
-        readPos += static_cast<float>(bufferSize);
+        readPos += static_cast<float>(bufMask + 1);
     
     // Get integer and fractional parts
     int i1 = static_cast<int>(readPos);
     float u = readPos - static_cast<float>(i1); // Fractional part in [0,1)
     
     // Get indices for 4-point cubic (p_{-1}, p_0, p_{+1}, p_{+2})
-    int im1 = (i1 - 1) & bufferMask;
-    int i0  = (i1 + 0) & bufferMask;
-    int ip1 = (i1 + 1) & bufferMask;
-    int ip2 = (i1 + 2) & bufferMask;
+    int im1 = (i1 - 1) & bufMask;
+    int i0  = (i1 + 0) & bufMask;
+    int ip1 = (i1 + 1) & bufMask;
+    int ip2 = (i1 + 2) & bufMask;
     
     // Get samples
     float pm1 = buf[static_cast<size_t>(im1)];
@@ -109,9 +92,65 @@ float ChorusCoreCubic::readCubic(int channel, float delaySamples) const
     return w_m1 * pm1 + w_0 * p0 + w_1 * p1 + w_2 * p2;
 }
 
+template <int NumChannels>
+void ChorusCoreCubic::processDelayFixed(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
+{
+    const int blockNumSamples = static_cast<int>(block.getNumSamples());
+
+    const float guardSamples = getGuardSamples();
+    const float maxDelaySamples = getMaxDelaySamples();
+
+    constexpr float maximumDelayModulation = 20.0f;
+    float centreDelaySamples = currentCentreDelayMs * spec.sampleRate / 1000.0f;
+    float depthSamples = maximumDelayModulation * spec.sampleRate / 1000.0f;
+
+    std::array<const float*, NumChannels> lfo {};
+    std::array<float*, NumChannels> samples {};
+    std::array<const float*, NumChannels> rings {};
+    for (size_t ch = 0; ch < static_cast<size_t>(NumChannels); ++ch)
+    {
+        // Right channel uses the quadrature LFO.
+        lfo[ch] = dsp.getChannelLfo(static_cast<int>(ch));
+        samples[ch] = block.getChannelPointer(ch);
+        rings[ch] = dsp.inputHistory[ch].data();
+    }
+
+    // The block is already in the history; the write head just walks along it.
+    const int historyMask = dsp.inputHistoryMask;
+    int writePos = dsp.inputHistoryBlockStart;
+    for (int i = 0; i < blockNumSamples; ++i)
+    {
+        writePos = (writePos + 1) & historyMask;
+        for (size_t ch = 0; ch < static_cast<size_t>(NumChannels); ++ch)
+        {
+            float delaySamp = centreDelaySamples + depthSamples * lfo[ch][i];
+            delaySamp = juce::jlimit(guardSamples, maxDelaySamples, delaySamp);
+
+            samples[ch][i] = readCubic(rings[ch], historyMask, writePos, delaySamp);
+        }
+    }
+}
+
 void ChorusCoreCubic::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
 {
     const int numChannels = static_cast<int>(block.getNumChannels());
+    if (channelLayout == ChannelLayout::stereo && numChannels == 2)
+    {
+        processDelayFixed<2>(dsp, block, currentCentreDelayMs);
+        return;
+    }
+    if (channelLayout == ChannelLayout::mono && numChannels == 1)
+    {
+        processDelayFixed<1>(dsp, block, currentCentreDelayMs);
+        return;
+    }
+
+    for (int ch = 0; ch < numChannels; ++ch)
+        processDelayChannel(dsp, block, currentCentreDelayMs, ch);
+}
+
+void ChorusCoreCubic::processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel)
+{
     const int blockNumSamples = static_cast<int>(block.getNumSamples());
     
     const float guardSamples = getGuardSamples();
@@ -121,32 +160,22 @@ void ChorusCoreCubic::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>&
     float centreDelaySamples = currentCentreDelayMs * spec.sampleRate / 1000.0f;
     float depthSamples = maximumDelayModulation * spec.sampleRate / 1000.0f;
     
-    // Access LFO buffers from ChorusDSP (friend class)
-    auto* lfoLeft = dsp.lfoBuffer.getReadPointer(0);
-    auto* lfoRight = (numChannels >= 2) ? dsp.cosBuffer.getReadPointer(0) : lfoLeft;
+    auto* outputSamples = block.getChannelPointer(channel);
+    const float* channelLfo = dsp.getChannelLfo(channel);
+    const float* history = dsp.inputHistory[static_cast<size_t>(channel)].data();
+    const int historyMask = dsp.inputHistoryMask;
+    int writePos = dsp.inputHistoryBlockStart;
     
-    for (int ch = 0; ch < numChannels; ++ch)
+    for (int i = 0; i < blockNumSamples; ++i)
     {
-        auto* inputSamples = block.getChannelPointer(ch);
-        auto* outputSamples = block.getChannelPointer(ch);
-        const float* channelLfo = (ch == 0) ? lfoLeft : lfoRight;
-        auto& buffer = delayBuffers[static_cast<size_t>(ch)];
-        int& writePos = writePositions[static_cast<size_t>(ch)];
+        float delaySamp = centreDelaySamples + depthSamples * channelLfo[i];
+        delaySamp = juce::jlimit(guardSamples, maxDelaySamples, delaySamp);
         
-        for (int i = 0; i < blockNumSamples; ++i)
-        {
-            float delaySamp = centreDelaySamples + depthSamples * channelLfo[i];
-            delaySamp = juce::jlimit(guardSamples, maxDelaySamples, delaySamp);
-            
-            const float in = inputSamples[i];
-            
-            // Write to buffer
-            buffer[static_cast<size_t>(writePos)] = in;
-            writePos = (writePos + 1) & bufferMask;
-            
-            // Read with cubic interpolation
-            const float out = readCubic(ch, delaySamp);
-            outputSamples[i] = out;
-        }
+        // Input was written to the shared history before the block; step past it
+        writePos = (writePos + 1) & historyMask;
+        
+        // Read with cubic interpolation
+        const float out = readCubic(history, historyMask, writePos, delaySamp);
+        outputSamples[i] = out;
     }
 }
@@ -19,7 +19,6 @@
 #pragma once
 
 #include "../ChorusCore.h"
-#include <vector>
 
 // Cubic (Catmull-Rom) interpolation chorus core
 // Blue Normal mode
@@ -32,18 +31,24 @@ public:
     void prepare(const juce::dsp::ProcessSpec& spec, ChorusDSP* dsp = nullptr) override;
     void reset() override;
     void processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs) override;
+    bool supportsChannelParallelism() const override { return true; }
+    void processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel) override;
     
     float getGuardSamples() const override { return 2.0f; } // Need 2 samples before and after
     float getMaxDelaySamples() const override;
+    int getSharedHistorySamples() const override { return historySamples; }
+    
+    // Cubic interpolation read (also Blue HQ's read while the CPU governor reduces quality)
+    static float readCubic(const float* buf, int bufMask, int writePos, float delaySamples);
     
 private:
-    std::vector<std::vector<float>> delayBuffers; // Per-channel circular buffers
-    std::vector<int> writePositions;
-    int bufferSize = 0;
-    int bufferMask = 0; // For power-of-2 size
+    // Reads ChorusDSP's shared input history; the core itself holds no delay memory.
+    int historySamples = 0;
     juce::dsp::ProcessSpec spec;
     int maxDelaySamples = 0;
-    
-    // Cubic interpolation read
-    float readCubic(int channel, float delaySamples) const;
+    ChannelLayout channelLayout = ChannelLayout::generic;
+
+    // Interleaved sample loop with per-channel state held in locals for the whole block.
+    template <int NumChannels>
+    void processDelayFixed(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs);
 };
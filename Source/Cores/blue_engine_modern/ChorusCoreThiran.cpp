@@ -17,17 +17,21 @@
  */
 
 #include "ChorusCoreThiran.h"
+#include "ChorusCoreCubic.h"
 #include "../../DSP/ChorusDSP.h"
 #include <cmath>
 #include <algorithm>
+#include <array>
 
 ChorusCoreThiran::ChorusCoreThiran()
 {
 }
 
-void ChorusCoreThiran::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusDSP*)
+void ChorusCoreThiran::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusDSP* dsp)
 {
+    jassert(dsp != nullptr);
     spec = processSpec;
+    channelLayout = channelLayoutFor(spec.numChannels);
 
     // Calculate maximum delay needed
     constexpr float maximumDelayModulation = 20.0f;
@@ -40,36 +44,28 @@ void ChorusCoreThiran::prepare(const juce::dsp::ProcessSpec& processSpec, Chorus
         (maximumDelayModulation * maxDepth * oscVolumeMultiplier + maxCentreDelayMs)
         * spec.sampleRate / 1000.0)) + guardMarginSamples;
     
-    // Round up to next power of 2
-    bufferSize = 1;
-    while (bufferSize < maxDelaySamples + SincFD::TAPS)
-        bufferSize <<= 1;
-    bufferMask = bufferSize - 1;
+    historySamples = maxDelaySamples + SincFD::TAPS;
     
-    // Allocate per-channel structures
-    sincFilters.resize(static_cast<size_t>(spec.numChannels));
-    delayBuffers.resize(static_cast<size_t>(spec.numChannels));
-    writePositions.resize(static_cast<size_t>(spec.numChannels));
-    smoothedDelays.resize(static_cast<size_t>(spec.numChannels), 0.0f);
-    delayInitialized.resize(static_cast<size_t>(spec.numChannels), false);
+    // Polyphase table is built once per process and shared by every channel and instance
+    sincTable = dsp->getTableRegistry().acquire<SincFD::Table>(
+        { choroboros::DspTableRegistry::TableKind::windowedSincKernel, 0.0, SincFD::PHASES, SincFD::TAPS },
+        &SincFD::buildTable);
     
-    for (size_t ch = 0; ch < delayBuffers.size(); ++ch)
-    {
-        delayBuffers[ch].assign(static_cast<size_t>(bufferSize), 0.0f);
-        writePositions[ch] = 0;
-        sincFilters[ch].buildTable(); // Build polyphase table
-        smoothedDelays[ch] = 0.0f;
-        delayInitialized[ch] = false;
-    }
+    // Allocate per-channel structures
+    smoothedDelays.assign(static_cast<size_t>(spec.numChannels), 0.0f);
+    delayInitialized.assign(static_cast<size_t>(spec.numChannels), 0);
 }
 
 void ChorusCoreThiran::reset()
 {
-    for (auto& buffer : delayBuffers)
-        std::fill(buffer.begin(), buffer.end(), 0.0f);
-    std::fill(writePositions.begin(), writePositions.end(), 0);
     std::fill(smoothedDelays.begin(), smoothedDelays.end(), 0.0f);
-    std::fill(delayInitialized.begin(), delayInitialized.end(), false);
+    std::fill(delayInitialized.begin(), delayInitialized.end(), 0);
+}
+
+void ChorusCoreThiran::resumeFromSharedHistory()
+{
+    // Re-seed the delay smoother from the LFO instead of gliding from where it was left.
+    std::fill(delayInitialized.begin(), delayInitialized.end(), 0);
 }
 
 float ChorusCoreThiran::getMaxDelaySamples() const
@@ -77,18 +73,85 @@ float ChorusCoreThiran::getMaxDelaySamples() const
     return static_cast<float>(maxDelaySamples) - getGuardSamples();
 }
 
-float ChorusCoreThiran::readSinc(int channel, float delaySamples) const
+template <int NumChannels>
+void ChorusCoreThiran::processDelayFixed(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
 {
-    const auto& buffer = delayBuffers[static_cast<size_t>(channel)];
-    const int wp = writePositions[static_cast<size_t>(channel)];
-    const auto& sinc = sincFilters[static_cast<size_t>(channel)];
-    
-    return sinc.read(buffer.data(), bufferMask, wp, delaySamples);
+    const int blockNumSamples = static_cast<int>(block.getNumSamples());
+
+    const float guardSamples = getGuardSamples();
+    const float maxDelaySamples = getMaxDelaySamples();
+
+    constexpr float maximumDelayModulation = 20.0f;
+    float centreDelaySamples = currentCentreDelayMs * spec.sampleRate / 1000.0f;
+    float depthSamples = maximumDelayModulation * spec.sampleRate / 1000.0f;
+    const bool reducedInterpolation = dsp.isHqInterpolationReduced();
+
+    std::array<const float*, NumChannels> lfo {};
+    std::array<float*, NumChannels> samples {};
+    std::array<const float*, NumChannels> rings {};
+    std::array<float, NumChannels> dSmooth {};
+    for (size_t ch = 0; ch < static_cast<size_t>(NumChannels); ++ch)
+    {
+        // Right channel uses the quadrature LFO.
+        lfo[ch] = dsp.getChannelLfo(static_cast<int>(ch));
+        samples[ch] = block.getChannelPointer(ch);
+        rings[ch] = dsp.inputHistory[ch].data();
+        dSmooth[ch] = smoothedDelays[ch];
+        if (!delayInitialized[ch])
+        {
+            float initialDelay = centreDelaySamples + depthSamples * lfo[ch][0];
+            initialDelay = juce::jlimit(guardSamples, maxDelaySamples, initialDelay);
+            dSmooth[ch] = initialDelay;
+            delayInitialized[ch] = 1;
+        }
+    }
+
+    // The block is already in the history; the write head just walks along it.
+    const auto& sinc = *sincTable;
+    const int historyMask = dsp.inputHistoryMask;
+    int writePos = dsp.inputHistoryBlockStart;
+    for (int i = 0; i < blockNumSamples; ++i)
+    {
+        for (size_t ch = 0; ch < static_cast<size_t>(NumChannels); ++ch)
+        {
+            float targetDelay = centreDelaySamples + depthSamples * lfo[ch][i];
+            targetDelay = juce::jlimit(guardSamples, maxDelaySamples, targetDelay);
+
+            constexpr float delaySmoothingCoeff = 0.998f; // ~5ms @ 48k
+            dSmooth[ch] = delaySmoothingCoeff * dSmooth[ch] + (1.0f - delaySmoothingCoeff) * targetDelay;
+
+            // Read relative to the current sample's slot, as in processDelayChannel.
+            samples[ch][i] = reducedInterpolation
+                ? ChorusCoreCubic::readCubic(rings[ch], historyMask, writePos, dSmooth[ch])
+                : SincFD::read(sinc, rings[ch], historyMask, writePos, dSmooth[ch]);
+        }
+        writePos = (writePos + 1) & historyMask;
+    }
+
+    for (size_t ch = 0; ch < static_cast<size_t>(NumChannels); ++ch)
+        smoothedDelays[ch] = dSmooth[ch];
 }
 
 void ChorusCoreThiran::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
 {
     const int numChannels = static_cast<int>(block.getNumChannels());
+    if (channelLayout == ChannelLayout::stereo && numChannels == 2)
+    {
+        processDelayFixed<2>(dsp, block, currentCentreDelayMs);
+        return;
+    }
+    if (channelLayout == ChannelLayout::mono && numChannels == 1)
+    {
+        processDelayFixed<1>(dsp, block, currentCentreDelayMs);
+        return;
+    }
+
+    for (int ch = 0; ch < numChannels; ++ch)
+        processDelayChannel(dsp, block, currentCentreDelayMs, ch);
+}
+
+void ChorusCoreThiran::processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel)
+{
     const int blockNumSamples = static_cast<int>(block.getNumSamples());
     
     const float guardSamples = getGuardSamples();
@@ -99,49 +162,41 @@ void ChorusCoreThiran::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>
     float depthSamples = maximumDelayModulation * spec.sampleRate / 1000.0f;
     
     // Access LFO buffers from ChorusDSP
-    auto* lfoLeft = dsp.lfoBuffer.getReadPointer(0);
-    auto* lfoRight = (numChannels >= 2) ? dsp.cosBuffer.getReadPointer(0) : lfoLeft;
+    auto* outputSamples = block.getChannelPointer(channel);
+    const float* channelLfo = dsp.getChannelLfo(channel);
+    const float* history = dsp.inputHistory[static_cast<size_t>(channel)].data();
+    const int historyMask = dsp.inputHistoryMask;
+    int writePos = dsp.inputHistoryBlockStart;
+    float& dSmooth = smoothedDelays[static_cast<size_t>(channel)];
+    const bool reducedInterpolation = dsp.isHqInterpolationReduced();
     
-    for (int ch = 0; ch < numChannels; ++ch)
+    // Initialize delay smoothing
+    if (!delayInitialized[static_cast<size_t>(channel)])
+    {
+        float initialDelay = centreDelaySamples + depthSamples * channelLfo[0];
+        initialDelay = juce::jlimit(guardSamples, maxDelaySamples, initialDelay);
+        dSmooth = initialDelay;
+        delayInitialized[static_cast<size_t>(channel)] = 1;
+    }
+    
+    for (int i = 0; i < blockNumSamples; ++i)
     {
-        auto* inputSamples = block.getChannelPointer(ch);
-        auto* outputSamples = block.getChannelPointer(ch);
-        const float* channelLfo = (ch == 0) ? lfoLeft : lfoRight;
-        auto& buffer = delayBuffers[static_cast<size_t>(ch)];
-        int& writePos = writePositions[static_cast<size_t>(ch)];
-        float& dSmooth = smoothedDelays[static_cast<size_t>(ch)];
+        // Target delay is measured from the current sample's history slot
+        float targetDelay = centreDelaySamples + depthSamples * channelLfo[i];
+        targetDelay = juce::jlimit(guardSamples, maxDelaySamples, targetDelay);
         
-        // Initialize delay smoothing
-        if (!delayInitialized[static_cast<size_t>(ch)])
-        {
-            float initialDelay = centreDelaySamples + depthSamples * channelLfo[0];
-            initialDelay = juce::jlimit(guardSamples, maxDelaySamples, initialDelay);
-            dSmooth = initialDelay;
-            delayInitialized[static_cast<size_t>(ch)] = true;
-        }
+        // Smooth delay to prevent artifacts (fast one-pole, similar to tape core)
+        constexpr float delaySmoothingCoeff = 0.998f; // ~5ms @ 48k
+        dSmooth = delaySmoothingCoeff * dSmooth + (1.0f - delaySmoothingCoeff) * targetDelay;
         
-        for (int i = 0; i < blockNumSamples; ++i)
-        {
-            const float in = inputSamples[i];
-            
-            // Calculate target delay from LFO BEFORE writing
-            // This ensures we read from the correct position relative to current write
-            float targetDelay = centreDelaySamples + depthSamples * channelLfo[i];
-            targetDelay = juce::jlimit(guardSamples, maxDelaySamples, targetDelay);
-            
-            // Smooth delay to prevent artifacts (fast one-pole, similar to tape core)
-            constexpr float delaySmoothingCoeff = 0.998f; // ~5ms @ 48k
-            dSmooth = delaySmoothingCoeff * dSmooth + (1.0f - delaySmoothingCoeff) * targetDelay;
-            
-            // Read with windowed-sinc polyphase FIR (read BEFORE writing)
-            // This ensures we read from samples that were written earlier
-            const float out = readSinc(ch, dSmooth);
-            
-            // Write to delay buffer AFTER reading
-            buffer[static_cast<size_t>(writePos)] = in;
-            writePos = (writePos + 1) & bufferMask;
-            
-            outputSamples[i] = out;
-        }
+        // Read with windowed-sinc polyphase FIR
+        // Falls back to Blue NQ's cubic read when the CPU governor is shedding load.
+        const float out = reducedInterpolation
+            ? ChorusCoreCubic::readCubic(history, historyMask, writePos, dSmooth)
+            : SincFD::read(*sincTable, history, historyMask, writePos, dSmooth);
+        
+        writePos = (writePos + 1) & historyMask;
+        
+        outputSamples[i] = out;
     }
 }
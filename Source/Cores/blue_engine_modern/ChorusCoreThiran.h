@@ -19,7 +19,10 @@
 #pragma once
 
 #include "../ChorusCore.h"
+#include "../../DSP/DspTableRegistry.h"
+#include <cstdint>
 #include <array>
+#include <memory>
 #include <vector>
 
 // Windowed-sinc polyphase FIR fractional delay chorus core
@@ -33,9 +36,13 @@ public:
     void prepare(const juce::dsp::ProcessSpec& spec, ChorusDSP* dsp = nullptr) override;
     void reset() override;
     void processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs) override;
+    bool supportsChannelParallelism() const override { return true; }
+    void processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel) override;
     
     float getGuardSamples() const override { return 16.0f; } // Need guard for FIR taps
     float getMaxDelaySamples() const override;
+    int getSharedHistorySamples() const override { return historySamples; }
+    void resumeFromSharedHistory() override;
     
 private:
     // Windowed-sinc polyphase FIR fractional delay
@@ -45,8 +52,8 @@ private:
         static constexpr int TAPS = 32;      // HQ: 32 taps for high quality
         static constexpr int HALF = TAPS / 2;
         
-        std::array<std::array<float, TAPS>, PHASES> table{};
-        bool tableBuilt = false;
+        // Immutable and identical for every instance; shared through DspTableRegistry.
+        using Table = std::array<std::array<float, TAPS>, PHASES>;
         
         static inline float sinc(float x)
         {
@@ -62,8 +69,10 @@ private:
             return 0.42f - 0.5f * std::cos(a) + 0.08f * std::cos(2.0f * a);
         }
         
-        void buildTable()
+        static std::unique_ptr<Table> buildTable(const choroboros::DspTableRegistry::Key&)
         {
+            auto built = std::make_unique<Table>();
+            auto& table = *built;
             for (int p = 0; p < PHASES; ++p)
             {
                 const float frac = static_cast<float>(p) / static_cast<float>(PHASES - 1); // 0..1
@@ -83,11 +92,11 @@ private:
                 for (int k = 0; k < TAPS; ++k)
                     table[static_cast<size_t>(p)][static_cast<size_t>(k)] *= inv;
             }
-            tableBuilt = true;
+            return built;
         }
         
         // Read from ring buffer at fractional position
-        float read(const float* buf, int bufMask, int writePos, float delaySamples) const
+        static float read(const Table& table, const float* buf, int bufMask, int writePos, float delaySamples)
         {
             // Calculate read position (behind write head)
             float readPos = static_cast<float>(writePos) - delaySamples;
@@ -130,15 +139,15 @@ private:
         }
     };
     
-    std::vector<SincFD> sincFilters; // One per channel
-    std::vector<std::vector<float>> delayBuffers;
-    std::vector<int> writePositions;
+    std::shared_ptr<const SincFD::Table> sincTable; // Process-wide, read-only
     std::vector<float> smoothedDelays; // Per-channel smoothed delay values
-    std::vector<bool> delayInitialized;
-    int bufferSize = 0;
-    int bufferMask = 0;
+    std::vector<uint8_t> delayInitialized; // Not vector<bool>: channels may be written concurrently
+    int historySamples = 0; // Delay memory is ChorusDSP's shared input history
     juce::dsp::ProcessSpec spec;
     int maxDelaySamples = 0;
-    
-    float readSinc(int channel, float delaySamples) const;
+    ChannelLayout channelLayout = ChannelLayout::generic;
+
+    // Interleaved sample loop with per-channel state held in locals for the whole block.
+    template <int NumChannels>
+    void processDelayFixed(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs);
 };
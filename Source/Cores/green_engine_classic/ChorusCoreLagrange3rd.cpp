@@ -65,15 +65,11 @@ void ChorusCoreLagrange3rd::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<f
     float centreDelaySamples = currentCentreDelayMs * spec.sampleRate / 1000.0f;
     float depthSamples = maximumDelayModulation * spec.sampleRate / 1000.0f;
     
-    // Access LFO buffers from ChorusDSP (friend class)
-    auto* lfoLeft = dsp.lfoBuffer.getReadPointer(0);
-    auto* lfoRight = (numChannels >= 2) ? dsp.cosBuffer.getReadPointer(0) : lfoLeft;
-    
     for (int ch = 0; ch < numChannels; ++ch)
     {
         auto* inputSamples = block.getChannelPointer(ch);
         auto* outputSamples = block.getChannelPointer(ch);
-        const float* channelLfo = (ch == 0) ? lfoLeft : lfoRight;
+        const float* channelLfo = dsp.getChannelLfo(ch);
         
         for (int i = 0; i < blockNumSamples; ++i)
         {
@@ -20,6 +20,7 @@
 #include "../../DSP/ChorusDSP.h"
 #include <cmath>
 #include <algorithm>
+#include <array>
 
 ChorusCoreLagrange5th::ChorusCoreLagrange5th()
 {
@@ -28,6 +29,7 @@ ChorusCoreLagrange5th::ChorusCoreLagrange5th()
 void ChorusCoreLagrange5th::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusDSP*)
 {
     spec = processSpec;
+    channelLayout = channelLayoutFor(spec.numChannels);
     
     // Calculate maximum delay needed
     constexpr float maximumDelayModulation = 20.0f;
@@ -40,28 +42,12 @@ void ChorusCoreLagrange5th::prepare(const juce::dsp::ProcessSpec& processSpec, C
         (maximumDelayModulation * maxDepth * oscVolumeMultiplier + maxCentreDelayMs)
         * spec.sampleRate / 1000.0)) + guardMarginSamples;
     
-    // Round up to next power of 2
-    bufferSize = 1;
-    while (bufferSize < maxDelaySamples + 6) // +6 for 5th order
-        bufferSize <<= 1;
-    bufferMask = bufferSize - 1;
-    
-    // Allocate buffers for each channel
-    delayBuffers.resize(static_cast<size_t>(spec.numChannels));
-    writePositions.resize(static_cast<size_t>(spec.numChannels));
-    
-    for (size_t ch = 0; ch < delayBuffers.size(); ++ch)
-    {
-        delayBuffers[ch].assign(static_cast<size_t>(bufferSize), 0.0f);
-        writePositions[ch] = 0;
-    }
+    historySamples = maxDelaySamples + 6; // +6 for 5th order
 }
 
 void ChorusCoreLagrange5th::reset()
 {
-    for (auto& buffer : delayBuffers)
-        std::fill(buffer.begin(), buffer.end(), 0.0f);
-    std::fill(writePositions.begin(), writePositions.end(), 0);
+    // Stateless apart from the shared input history, which ChorusDSP clears.
 }
 
 float ChorusCoreLagrange5th::getMaxDelaySamples() const
@@ -69,15 +55,12 @@ float ChorusCoreLagrange5th::getMaxDelaySamples() const
     return static_cast<float>(maxDelaySamples) - getGuardSamples();
 }
 
-float ChorusCoreLagrange5th::readLagrange5th(int channel, float delaySamples) const
+float ChorusCoreLagrange5th::readLagrange5th(const float* buf, int bufMask, int writePos, float delaySamples)
 {
-    const auto& buf = delayBuffers[static_cast<size_t>(channel)];
-    const int writePos = writePositions[static_cast<size_t>(channel)];
-    
     // Calculate read position
     float readPos = static_cast<float>(writePos) - delaySamples;
     while (readPos < 0.0f)
-        readPos += static_cast<float>(bufferSize);
+        readPos += static_cast<float>(bufMask + 1);
     
     // Get integer and fractional parts
     int i0 = static_cast<int>(readPos);
@@ -85,12 +68,12 @@ float ChorusCoreLagrange5th::readLagrange5th(int channel, float delaySamples) co
     
     // Get 6 samples for 5th order Lagrange: x[-2], x[-1], x[0], x[1], x[2], x[3]
     int indices[6];
-    indices[0] = (i0 - 2) & bufferMask;
-    indices[1] = (i0 - 1) & bufferMask;
-    indices[2] = (i0 + 0) & bufferMask;
-    indices[3] = (i0 + 1) & bufferMask;
-    indices[4] = (i0 + 2) & bufferMask;
-    indices[5] = (i0 + 3) & bufferMask;
+    indices[0] = (i0 - 2) & bufMask;
+    indices[1] = (i0 - 1) & bufMask;
+    indices[2] = (i0 + 0) & bufMask;
+    indices[3] = (i0 + 1) & bufMask;
+    indices[4] = (i0 + 2) & bufMask;
+    indices[5] = (i0 + 3) & bufMask;
     
     float samples[6];
     for (int i = 0; i < 6; ++i)
@@ -117,9 +100,68 @@ float ChorusCoreLagrange5th::readLagrange5th(int channel, float delaySamples) co
     return result;
 }
 
+template <int NumChannels>
+void ChorusCoreLagrange5th::processDelayFixed(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
+{
+    const int blockNumSamples = static_cast<int>(block.getNumSamples());
+
+    const float guardSamples = getGuardSamples();
+    const float maxDelaySamples = getMaxDelaySamples();
+
+    constexpr float maximumDelayModulation = 20.0f;
+    float centreDelaySamples = currentCentreDelayMs * spec.sampleRate / 1000.0f;
+    float depthSamples = maximumDelayModulation * spec.sampleRate / 1000.0f;
+    const bool reducedInterpolation = dsp.isHqInterpolationReduced();
+
+    std::array<const float*, NumChannels> lfo {};
+    std::array<float*, NumChannels> samples {};
+    std::array<const float*, NumChannels> rings {};
+    for (size_t ch = 0; ch < static_cast<size_t>(NumChannels); ++ch)
+    {
+        // Right channel uses the quadrature LFO.
+        lfo[ch] = dsp.getChannelLfo(static_cast<int>(ch));
+        samples[ch] = block.getChannelPointer(ch);
+        rings[ch] = dsp.inputHistory[ch].data();
+    }
+
+    // The block is already in the history; the write head just walks along it.
+    const int historyMask = dsp.inputHistoryMask;
+    int writePos = dsp.inputHistoryBlockStart;
+    for (int i = 0; i < blockNumSamples; ++i)
+    {
+        writePos = (writePos + 1) & historyMask;
+        for (size_t ch = 0; ch < static_cast<size_t>(NumChannels); ++ch)
+        {
+            float delaySamp = centreDelaySamples + depthSamples * lfo[ch][i];
+            delaySamp = juce::jlimit(guardSamples, maxDelaySamples, delaySamp);
+
+            samples[ch][i] = reducedInterpolation
+                ? readLagrange3rd(rings[ch], historyMask, writePos, delaySamp)
+                : readLagrange5th(rings[ch], historyMask, writePos, delaySamp);
+        }
+    }
+}
+
 void ChorusCoreLagrange5th::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
 {
     const int numChannels = static_cast<int>(block.getNumChannels());
+    if (channelLayout == ChannelLayout::stereo && numChannels == 2)
+    {
+        processDelayFixed<2>(dsp, block, currentCentreDelayMs);
+        return;
+    }
+    if (channelLayout == ChannelLayout::mono && numChannels == 1)
+    {
+        processDelayFixed<1>(dsp, block, currentCentreDelayMs);
+        return;
+    }
+
+    for (int ch = 0; ch < numChannels; ++ch)
+        processDelayChannel(dsp, block, currentCentreDelayMs, ch);
+}
+
+void ChorusCoreLagrange5th::processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel)
+{
     const int blockNumSamples = static_cast<int>(block.getNumSamples());
     
     const float guardSamples = getGuardSamples();
@@ -130,31 +172,25 @@ void ChorusCoreLagrange5th::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<f
     float depthSamples = maximumDelayModulation * spec.sampleRate / 1000.0f;
     
     // Access LFO buffers from ChorusDSP
-    auto* lfoLeft = dsp.lfoBuffer.getReadPointer(0);
-    auto* lfoRight = (numChannels >= 2) ? dsp.cosBuffer.getReadPointer(0) : lfoLeft;
+    auto* outputSamples = block.getChannelPointer(channel);
+    const float* channelLfo = dsp.getChannelLfo(channel);
+    const float* history = dsp.inputHistory[static_cast<size_t>(channel)].data();
+    const int historyMask = dsp.inputHistoryMask;
+    int writePos = dsp.inputHistoryBlockStart;
+    const bool reducedInterpolation = dsp.isHqInterpolationReduced();
     
-    for (int ch = 0; ch < numChannels; ++ch)
+    for (int i = 0; i < blockNumSamples; ++i)
     {
-        auto* inputSamples = block.getChannelPointer(ch);
-        auto* outputSamples = block.getChannelPointer(ch);
-        const float* channelLfo = (ch == 0) ? lfoLeft : lfoRight;
-        auto& buffer = delayBuffers[static_cast<size_t>(ch)];
-        int& writePos = writePositions[static_cast<size_t>(ch)];
+        float delaySamp = centreDelaySamples + depthSamples * channelLfo[i];
+        delaySamp = juce::jlimit(guardSamples, maxDelaySamples, delaySamp);
         
-        for (int i = 0; i < blockNumSamples; ++i)
-        {
-            float delaySamp = centreDelaySamples + depthSamples * channelLfo[i];
-            delaySamp = juce::jlimit(guardSamples, maxDelaySamples, delaySamp);
-            
-            const float in = inputSamples[i];
-            
-            // Write to buffer
-            buffer[static_cast<size_t>(writePos)] = in;
-            writePos = (writePos + 1) & bufferMask;
-            
-            // Read with Lagrange 5th order
-            const float out = readLagrange5th(ch, delaySamp);
-            outputSamples[i] = out;
-        }
+        // Input was written to the shared history before the block; step past it
+        writePos = (writePos + 1) & historyMask;
+        
+        // Read with Lagrange 5th order (3rd order when the CPU governor is shedding load)
+        const float out = reducedInterpolation
+            ? readLagrange3rd(history, historyMask, writePos, delaySamp)
+            : readLagrange5th(history, historyMask, writePos, delaySamp);
+        outputSamples[i] = out;
     }
 }
@@ -19,7 +19,6 @@
 #pragma once
 
 #include "../ChorusCore.h"
-#include <vector>
 
 // Lagrange 5th order interpolation chorus core
 // Green HQ mode (manual implementation since JUCE doesn't provide it)
@@ -32,18 +31,24 @@ public:
     void prepare(const juce::dsp::ProcessSpec& spec, ChorusDSP* dsp = nullptr) override;
     void reset() override;
     void processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs) override;
+    bool supportsChannelParallelism() const override { return true; }
+    void processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel) override;
     
     float getGuardSamples() const override { return 3.0f; } // Need 3 samples before and after
     float getMaxDelaySamples() const override;
+    int getSharedHistorySamples() const override { return historySamples; }
     
 private:
-    std::vector<std::vector<float>> delayBuffers;
-    std::vector<int> writePositions;
-    int bufferSize = 0;
-    int bufferMask = 0;
+    // Reads ChorusDSP's shared input history; the core itself holds no delay memory.
+    int historySamples = 0;
     juce::dsp::ProcessSpec spec;
     int maxDelaySamples = 0;
+    ChannelLayout channelLayout = ChannelLayout::generic;
+
+    // Interleaved sample loop with per-channel state held in locals for the whole block.
+    template <int NumChannels>
+    void processDelayFixed(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs);
     
     // Lagrange 5th order interpolation (6-point)
-    float readLagrange5th(int channel, float delaySamples) const;
+    static float readLagrange5th(const float* buf, int bufMask, int writePos, float delaySamples);
 };
@@ -20,6 +20,7 @@
 #include "../../DSP/ChorusDSP.h"
 #include <cmath>
 #include <algorithm>
+#include <array>
 
 ChorusCoreOrbit::ChorusCoreOrbit()
 {
@@ -40,15 +41,9 @@ void ChorusCoreOrbit::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusD
         (maximumDelayModulation * maxDepth * oscVolumeMultiplier + maxCentreDelayMs)
         * spec.sampleRate / 1000.0)) + guardMarginSamples;
     
-    // Round up to next power of 2 for efficient masking
-    bufferSize = 1;
-    while (bufferSize < maxDelaySamples + 4) // +4 for cubic interpolation
-        bufferSize <<= 1;
-    bufferMask = bufferSize - 1;
+    historySamples = maxDelaySamples + 4; // +4 for cubic interpolation
     
-    // Allocate buffers for each channel
-    delayBuffers.resize(static_cast<size_t>(spec.numChannels));
-    writePositions.resize(static_cast<size_t>(spec.numChannels));
+    // Allocate per-channel modulation state
     orbitStates.resize(static_cast<size_t>(spec.numChannels));
     delaySmoothers1.resize(static_cast<size_t>(spec.numChannels));
     delaySmoothers2.resize(static_cast<size_t>(spec.numChannels));
@@ -59,10 +54,8 @@ void ChorusCoreOrbit::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusD
     const float delaySmoothingSec = delaySmoothingMs * 0.001f;
     lastDelaySmoothingMs = delaySmoothingMs;
     
-    for (size_t ch = 0; ch < delayBuffers.size(); ++ch)
+    for (size_t ch = 0; ch < orbitStates.size(); ++ch)
     {
-        delayBuffers[ch].assign(static_cast<size_t>(bufferSize), 0.0f);
-        writePositions[ch] = 0;
         
         auto& state = orbitStates[ch];
         state.phase = 0.0f;
@@ -81,10 +74,6 @@ void ChorusCoreOrbit::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusD
 
 void ChorusCoreOrbit::reset()
 {
-    for (auto& buffer : delayBuffers)
-        std::fill(buffer.begin(), buffer.end(), 0.0f);
-    std::fill(writePositions.begin(), writePositions.end(), 0);
-    
     for (size_t ch = 0; ch < orbitStates.size(); ++ch)
     {
         auto& state = orbitStates[ch];
@@ -100,6 +89,13 @@ void ChorusCoreOrbit::reset()
     lastDelaySmoothingMs = -1.0f;
 }
 
+void ChorusCoreOrbit::resumeFromSharedHistory()
+{
+    // Snap both tap smoothers to the current orbit instead of gliding from stale values.
+    for (auto& state : orbitStates)
+        state.initialized = false;
+}
+
 float ChorusCoreOrbit::getMaxDelaySamples() const
 {
     return static_cast<float>(maxDelaySamples) - getGuardSamples();
@@ -121,27 +117,24 @@ float ChorusCoreOrbit::computeOrbitModulation(float phase, float theta, float ec
     return u;
 }
 
-float ChorusCoreOrbit::readCubic(int channel, float delaySamples) const
+float ChorusCoreOrbit::readCubic(const float* buf, int bufMask, int writePos, float delaySamples)
 {
-    const auto& buf = delayBuffers[static_cast<size_t>(channel)];
-    const int writePos = writePositions[static_cast<size_t>(channel)];
-    
     // Calculate read position (behind write head)
     float readPos = static_cast<float>(writePos) - delaySamples;
     
     // Wrap to positive range
     while (readPos < 0.0f)
-        readPos += static_cast<float>(bufferSize);
+        readPos += static_cast<float>(bufMask + 1);
     
     // Get integer and fractional parts
     int i1 = static_cast<int>(readPos);
     float u = readPos - static_cast<float>(i1); // Fractional part in [0,1)
     
     // Get indices for 4-point cubic (p_{-1}, p_0, p_{+1}, p_{+2})
-    int im1 = (i1 - 1) & bufferMask;
-    int i0  = (i1 + 0) & bufferMask;
-    int ip1 = (i1 + 1) & bufferMask;
-    int ip2 = (i1 + 2) & bufferMask;
+    int im1 = (i1 - 1) & bufMask;
+    int i0  = (i1 + 0) & bufMask;
+    int ip1 = (i1 + 1) & bufMask;
+    int ip2 = (i1 + 2) & bufMask;
     
     // Get samples
     float pm1 = buf[static_cast<size_t>(im1)];
@@ -163,7 +156,35 @@ float ChorusCoreOrbit::readCubic(int channel, float delaySamples) const
 
 void ChorusCoreOrbit::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
 {
+    beginDelayBlock(dsp, block, currentCentreDelayMs);
     const int numChannels = static_cast<int>(block.getNumChannels());
+    for (int ch = 0; ch < numChannels; ++ch)
+        processDelayChannel(dsp, block, currentCentreDelayMs, ch);
+}
+
+void ChorusCoreOrbit::beginDelayBlock(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
+{
+    juce::ignoreUnused(block, currentCentreDelayMs);
+    const auto& tuning = dsp.runtimeTuningSnapshot;
+    const float delaySmoothingMs = juce::jmax(0.0f, tuning.purpleOrbitDelaySmoothingMs);
+    if (std::abs(delaySmoothingMs - lastDelaySmoothingMs) > 1.0e-3f)
+    {
+        const float delaySmoothingSec = delaySmoothingMs * 0.001f;
+        for (size_t ch = 0; ch < delaySmoothers1.size(); ++ch)
+        {
+            const float current1 = delaySmoothers1[ch].getCurrentValue();
+            const float current2 = delaySmoothers2[ch].getCurrentValue();
+            delaySmoothers1[ch].reset(spec.sampleRate, delaySmoothingSec);
+            delaySmoothers2[ch].reset(spec.sampleRate, delaySmoothingSec);
+            delaySmoothers1[ch].setCurrentAndTargetValue(current1);
+            delaySmoothers2[ch].setCurrentAndTargetValue(current2);
+        }
+        lastDelaySmoothingMs = delaySmoothingMs;
+    }
+}
+
+void ChorusCoreOrbit::processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel)
+{
     const int blockNumSamples = static_cast<int>(block.getNumSamples());
     
     const float guardSamples = getGuardSamples();
@@ -197,97 +218,86 @@ void ChorusCoreOrbit::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>&
     // Dual tap mix ratios for ensemble density.
     const float mix1 = juce::jlimit(0.0f, 1.0f, tuning.purpleOrbitMix1);
     const float mix2 = 1.0f - mix1;
-
-    const float delaySmoothingMs = juce::jmax(0.0f, tuning.purpleOrbitDelaySmoothingMs);
-    if (std::abs(delaySmoothingMs - lastDelaySmoothingMs) > 1.0e-3f)
-    {
-        const float delaySmoothingSec = delaySmoothingMs * 0.001f;
-        for (size_t ch = 0; ch < delaySmoothers1.size(); ++ch)
-        {
-            const float current1 = delaySmoothers1[ch].getCurrentValue();
-            const float current2 = delaySmoothers2[ch].getCurrentValue();
-            delaySmoothers1[ch].reset(spec.sampleRate, delaySmoothingSec);
-            delaySmoothers2[ch].reset(spec.sampleRate, delaySmoothingSec);
-            delaySmoothers1[ch].setCurrentAndTargetValue(current1);
-            delaySmoothers2[ch].setCurrentAndTargetValue(current2);
-        }
-        lastDelaySmoothingMs = delaySmoothingMs;
-    }
     
-    for (int ch = 0; ch < numChannels; ++ch)
+    auto* outputSamples = block.getChannelPointer(channel);
+    const float* history = dsp.inputHistory[static_cast<size_t>(channel)].data();
+    const int historyMask = dsp.inputHistoryMask;
+    int writePos = dsp.inputHistoryBlockStart;
+    auto& state = orbitStates[static_cast<size_t>(channel)];
+    auto& delaySmoother1 = delaySmoothers1[static_cast<size_t>(channel)];
+    auto& delaySmoother2 = delaySmoothers2[static_cast<size_t>(channel)];
+    
+    // Slight stereo decorrelation: offset theta for the right channel of each pair;
+    // surround pairs and lone channels also rotate by their share of the LFO spread.
+    const auto& spread = dsp.channelLfoSpread[static_cast<size_t>(channel)];
+    float thetaOffset = (spread.followsOffset ? tuning.purpleOrbitStereoThetaOffset : 0.0f)
+                      + spread.phaseRad / juce::MathConstants<float>::twoPi;
+    
+    // Initialize delays on first sample if needed
+    if (!state.initialized)
     {
-        auto* inputSamples = block.getChannelPointer(ch);
-        auto* outputSamples = block.getChannelPointer(ch);
-        auto& buffer = delayBuffers[static_cast<size_t>(ch)];
-        int& writePos = writePositions[static_cast<size_t>(ch)];
-        auto& state = orbitStates[static_cast<size_t>(ch)];
-        auto& delaySmoother1 = delaySmoothers1[static_cast<size_t>(ch)];
-        auto& delaySmoother2 = delaySmoothers2[static_cast<size_t>(ch)];
+        float mod1 = computeOrbitModulation(state.phase, state.theta + thetaOffset, eccentricity);
+        float mod2 = computeOrbitModulation(state.phase, state.theta2 + thetaOffset, eccentricity2);
         
-        // Slight stereo decorrelation: offset theta for right channel.
-        float thetaOffset = (ch == 1) ? tuning.purpleOrbitStereoThetaOffset : 0.0f;
-        
-        // Initialize delays on first sample if needed
-        if (!state.initialized)
-        {
-            float mod1 = computeOrbitModulation(state.phase, state.theta + thetaOffset, eccentricity);
-            float mod2 = computeOrbitModulation(state.phase, state.theta2 + thetaOffset, eccentricity2);
-            
-            float initialDelay1 = centreDelaySamples + depthSamples * mod1;
-            float initialDelay2 = centreDelaySamples + depthSamples * mod2;
-            initialDelay1 = juce::jlimit(guardSamples, maxDelaySamples, initialDelay1);
-            initialDelay2 = juce::jlimit(guardSamples, maxDelaySamples, initialDelay2);
-            
-            state.smoothedDelay1 = initialDelay1;
-            state.smoothedDelay2 = initialDelay2;
-            delaySmoother1.setCurrentAndTargetValue(initialDelay1);
-            delaySmoother2.setCurrentAndTargetValue(initialDelay2);
-            state.initialized = true;
-        }
+        float initialDelay1 = centreDelaySamples + depthSamples * mod1;
+        float initialDelay2 = centreDelaySamples + depthSamples * mod2;
+        initialDelay1 = juce::jlimit(guardSamples, maxDelaySamples, initialDelay1);
+        initialDelay2 = juce::jlimit(guardSamples, maxDelaySamples, initialDelay2);
         
-        for (int i = 0; i < blockNumSamples; ++i)
+        state.smoothedDelay1 = initialDelay1;
+        state.smoothedDelay2 = initialDelay2;
+        delaySmoother1.setCurrentAndTargetValue(initialDelay1);
+        delaySmoother2.setCurrentAndTargetValue(initialDelay2);
+        state.initialized = true;
+    }
+    
+    std::array<float, choroboros::kBlockRampChunkSamples> delays1;
+    std::array<float, choroboros::kBlockRampChunkSamples> delays2;
+    for (int start = 0; start < blockNumSamples; start += choroboros::kBlockRampChunkSamples)
+    {
+        const int chunk = juce::jmin(choroboros::kBlockRampChunkSamples, blockNumSamples - start);
+
+        for (int i = 0; i < chunk; ++i)
         {
-            const float in = inputSamples[i];
-            
-            // Write to buffer (once per sample, shared by both taps)
-            buffer[static_cast<size_t>(writePos)] = in;
-            writePos = (writePos + 1) & bufferMask;
-            
             // Advance phases
             state.phase += phaseInc;
             if (state.phase >= 1.0f)
                 state.phase -= 1.0f;
-            
+
             state.theta += thetaInc;
             if (state.theta >= 1.0f)
                 state.theta -= 1.0f;
-            
+
             state.theta2 += thetaInc2;
             if (state.theta2 >= 1.0f)
                 state.theta2 -= 1.0f;
-            
+
             // Compute orbit modulation for both taps
             float mod1 = computeOrbitModulation(state.phase, state.theta + thetaOffset, eccentricity);
             float mod2 = computeOrbitModulation(state.phase, state.theta2 + thetaOffset, eccentricity2);
-            
+
             // Calculate target delays
             float targetDelay1 = centreDelaySamples + depthSamples * mod1;
             float targetDelay2 = centreDelaySamples + depthSamples * mod2;
-            targetDelay1 = juce::jlimit(guardSamples, maxDelaySamples, targetDelay1);
-            targetDelay2 = juce::jlimit(guardSamples, maxDelaySamples, targetDelay2);
-            
-            // Smooth delays (20ms ramp)
-            delaySmoother1.setTargetValue(targetDelay1);
-            delaySmoother2.setTargetValue(targetDelay2);
-            float delaySamp1 = delaySmoother1.getNextValue();
-            float delaySamp2 = delaySmoother2.getNextValue();
-            
+            delays1[static_cast<size_t>(i)] = juce::jlimit(guardSamples, maxDelaySamples, targetDelay1);
+            delays2[static_cast<size_t>(i)] = juce::jlimit(guardSamples, maxDelaySamples, targetDelay2);
+        }
+
+        // Smooth delays (20ms ramp)
+        delaySmoother1.process(delays1.data(), delays1.data(), chunk);
+        delaySmoother2.process(delays2.data(), delays2.data(), chunk);
+
+        for (int i = 0; i < chunk; ++i)
+        {
+            // Input is already in the shared history; step past it (once per sample, both taps)
+            writePos = (writePos + 1) & historyMask;
+
             // Read both taps with cubic interpolation
-            float wet1 = readCubic(ch, delaySamp1);
-            float wet2 = readCubic(ch, delaySamp2);
-            
+            float wet1 = readCubic(history, historyMask, writePos, delays1[static_cast<size_t>(i)]);
+            float wet2 = readCubic(history, historyMask, writePos, delays2[static_cast<size_t>(i)]);
+
             // Mix dual taps for ensemble density
-            outputSamples[i] = mix1 * wet1 + mix2 * wet2;
+            outputSamples[start + i] = mix1 * wet1 + mix2 * wet2;
         }
     }
 }
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "../ChorusCore.h"
+#include "../../DSP/BlockRamp.h"
 #include <vector>
 
 // Orbit Chorus core (2D LFO with rotating axis)
@@ -34,15 +35,17 @@ public:
     void prepare(const juce::dsp::ProcessSpec& spec, ChorusDSP* dsp = nullptr) override;
     void reset() override;
     void processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs) override;
+    bool supportsChannelParallelism() const override { return true; }
+    void beginDelayBlock(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs) override;
+    void processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel) override;
     
     float getGuardSamples() const override { return 2.0f; } // Cubic interpolation needs 2 samples
     float getMaxDelaySamples() const override;
+    int getSharedHistorySamples() const override { return historySamples; }
+    void resumeFromSharedHistory() override;
     
 private:
-    std::vector<std::vector<float>> delayBuffers; // Per-channel circular buffers
-    std::vector<int> writePositions;
-    int bufferSize = 0;
-    int bufferMask = 0; // For power-of-2 size
+    int historySamples = 0; // Delay memory is ChorusDSP's shared input history
     juce::dsp::ProcessSpec spec;
     int maxDelaySamples = 0;
     
@@ -59,12 +62,12 @@ private:
     std::vector<OrbitState> orbitStates;
     
     // Delay smoothing (10-30ms ramp) - one per tap
-    std::vector<juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear>> delaySmoothers1;
-    std::vector<juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear>> delaySmoothers2;
+    std::vector<choroboros::OnePoleBlockRamp> delaySmoothers1;
+    std::vector<choroboros::OnePoleBlockRamp> delaySmoothers2;
     float lastDelaySmoothingMs = -1.0f;
     
     // Cubic interpolation read (same as Blue Normal)
-    float readCubic(int channel, float delaySamples) const;
+    static float readCubic(const float* buf, int bufMask, int writePos, float delaySamples);
     
     // Compute orbit modulation
     // Returns modulation signal u in range [-1, 1] for given phase, theta, and eccentricity
@@ -20,6 +20,7 @@
 #include "../../DSP/ChorusDSP.h"
 #include <cmath>
 #include <algorithm>
+#include <array>
 
 ChorusCorePhaseWarped::ChorusCorePhaseWarped()
 {
@@ -40,15 +41,9 @@ void ChorusCorePhaseWarped::prepare(const juce::dsp::ProcessSpec& processSpec, C
         (maximumDelayModulation * maxDepth * oscVolumeMultiplier + maxCentreDelayMs)
         * spec.sampleRate / 1000.0)) + guardMarginSamples;
     
-    // Round up to next power of 2 for efficient masking
-    bufferSize = 1;
-    while (bufferSize < maxDelaySamples + 4) // +4 for cubic interpolation
-        bufferSize <<= 1;
-    bufferMask = bufferSize - 1;
+    historySamples = maxDelaySamples + 4; // +4 for cubic interpolation
     
-    // Allocate buffers for each channel
-    delayBuffers.resize(static_cast<size_t>(spec.numChannels));
-    writePositions.resize(static_cast<size_t>(spec.numChannels));
+    // Allocate per-channel modulation state
     phaseStates.resize(static_cast<size_t>(spec.numChannels));
     delaySmoothers.resize(static_cast<size_t>(spec.numChannels));
 
@@ -58,10 +53,8 @@ void ChorusCorePhaseWarped::prepare(const juce::dsp::ProcessSpec& processSpec, C
     const float delaySmoothingSec = delaySmoothingMs * 0.001f;
     lastDelaySmoothingMs = delaySmoothingMs;
     
-    for (size_t ch = 0; ch < delayBuffers.size(); ++ch)
+    for (size_t ch = 0; ch < phaseStates.size(); ++ch)
     {
-        delayBuffers[ch].assign(static_cast<size_t>(bufferSize), 0.0f);
-        writePositions[ch] = 0;
         phaseStates[ch].phase = 0.0f;
         phaseStates[ch].smoothedDelay = 0.0f;
         phaseStates[ch].initialized = false;
@@ -73,10 +66,6 @@ void ChorusCorePhaseWarped::prepare(const juce::dsp::ProcessSpec& processSpec, C
 
 void ChorusCorePhaseWarped::reset()
 {
-    for (auto& buffer : delayBuffers)
-        std::fill(buffer.begin(), buffer.end(), 0.0f);
-    std::fill(writePositions.begin(), writePositions.end(), 0);
-    
     for (size_t ch = 0; ch < phaseStates.size(); ++ch)
     {
         phaseStates[ch].phase = 0.0f;
@@ -87,6 +76,13 @@ void ChorusCorePhaseWarped::reset()
     lastDelaySmoothingMs = -1.0f;
 }
 
+void ChorusCorePhaseWarped::resumeFromSharedHistory()
+{
+    // Snap the delay smoothers to the current modulation instead of gliding from a stale value.
+    for (auto& state : phaseStates)
+        state.initialized = false;
+}
+
 float ChorusCorePhaseWarped::getMaxDelaySamples() const
 {
     return static_cast<float>(maxDelaySamples) - getGuardSamples();
@@ -104,27 +100,24 @@ float ChorusCorePhaseWarped::computeWarpedModulation(float phase, float a, float
     return std::sin(warpedPhase);
 }
 
-float ChorusCorePhaseWarped::readCubic(int channel, float delaySamples) const
+float ChorusCorePhaseWarped::readCubic(const float* buf, int bufMask, int writePos, float delaySamples)
 {
-    const auto& buf = delayBuffers[static_cast<size_t>(channel)];
-    const int writePos = writePositions[static_cast<size_t>(channel)];
-    
     // Calculate read position (behind write head)
     float readPos = static_cast<float>(writePos) - delaySamples;
     
     // Wrap to positive range
     while (readPos < 0.0f)
-        readPos += static_cast<float>(bufferSize);
+        readPos += static_cast<float>(bufMask + 1);
     
     // Get integer and fractional parts
     int i1 = static_cast<int>(readPos);
     float u = readPos - static_cast<float>(i1); // Fractional part in [0,1)
     
     // Get indices for 4-point cubic (p_{-1}, p_0, p_{+1}, p_{+2})
-    int im1 = (i1 - 1) & bufferMask;
-    int i0  = (i1 + 0) & bufferMask;
-    int ip1 = (i1 + 1) & bufferMask;
-    int ip2 = (i1 + 2) & bufferMask;
+    int im1 = (i1 - 1) & bufMask;
+    int i0  = (i1 + 0) & bufMask;
+    int ip1 = (i1 + 1) & bufMask;
+    int ip2 = (i1 + 2) & bufMask;
     
     // Get samples
     float pm1 = buf[static_cast<size_t>(im1)];
@@ -146,7 +139,32 @@ float ChorusCorePhaseWarped::readCubic(int channel, float delaySamples) const
 
 void ChorusCorePhaseWarped::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
 {
+    beginDelayBlock(dsp, block, currentCentreDelayMs);
     const int numChannels = static_cast<int>(block.getNumChannels());
+    for (int ch = 0; ch < numChannels; ++ch)
+        processDelayChannel(dsp, block, currentCentreDelayMs, ch);
+}
+
+void ChorusCorePhaseWarped::beginDelayBlock(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
+{
+    juce::ignoreUnused(block, currentCentreDelayMs);
+    const auto& tuning = dsp.runtimeTuningSnapshot;
+    const float delaySmoothingMs = juce::jmax(0.0f, tuning.purpleWarpDelaySmoothingMs);
+    if (std::abs(delaySmoothingMs - lastDelaySmoothingMs) > 1.0e-3f)
+    {
+        const float delaySmoothingSec = delaySmoothingMs * 0.001f;
+        for (size_t ch = 0; ch < delaySmoothers.size(); ++ch)
+        {
+            const float current = delaySmoothers[ch].getCurrentValue();
+            delaySmoothers[ch].reset(spec.sampleRate, delaySmoothingSec);
+            delaySmoothers[ch].setCurrentAndTargetValue(current);
+        }
+        lastDelaySmoothingMs = delaySmoothingMs;
+    }
+}
+
+void ChorusCorePhaseWarped::processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel)
+{
     const int blockNumSamples = static_cast<int>(block.getNumSamples());
     
     const float guardSamples = getGuardSamples();
@@ -168,67 +186,55 @@ void ChorusCorePhaseWarped::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<f
     const float warpA = juce::jmax(0.0f, tuning.purpleWarpA) * warpAmount;
     const float warpB = juce::jmax(0.0f, tuning.purpleWarpB) * warpAmount;
     const float warpK = juce::jmax(0.1f, tuning.purpleWarpKBase + tuning.purpleWarpKScale * warpAmount);
-
-    const float delaySmoothingMs = juce::jmax(0.0f, tuning.purpleWarpDelaySmoothingMs);
-    if (std::abs(delaySmoothingMs - lastDelaySmoothingMs) > 1.0e-3f)
+    
+    auto* outputSamples = block.getChannelPointer(channel);
+    const float* history = dsp.inputHistory[static_cast<size_t>(channel)].data();
+    const int historyMask = dsp.inputHistoryMask;
+    int writePos = dsp.inputHistoryBlockStart;
+    auto& state = phaseStates[static_cast<size_t>(channel)];
+    auto& delaySmoother = delaySmoothers[static_cast<size_t>(channel)];
+    
+    // Initialize delay on first sample if needed
+    if (!state.initialized)
     {
-        const float delaySmoothingSec = delaySmoothingMs * 0.001f;
-        for (size_t ch = 0; ch < delaySmoothers.size(); ++ch)
-        {
-            const float current = delaySmoothers[ch].getCurrentValue();
-            delaySmoothers[ch].reset(spec.sampleRate, delaySmoothingSec);
-            delaySmoothers[ch].setCurrentAndTargetValue(current);
-        }
-        lastDelaySmoothingMs = delaySmoothingMs;
+        float initialMod = computeWarpedModulation(state.phase, warpA, warpB, warpK);
+        float initialDelay = centreDelaySamples + depthSamples * initialMod;
+        initialDelay = juce::jlimit(guardSamples, maxDelaySamples, initialDelay);
+        state.smoothedDelay = initialDelay;
+        delaySmoother.setCurrentAndTargetValue(initialDelay);
+        state.initialized = true;
     }
     
-    for (int ch = 0; ch < numChannels; ++ch)
+    std::array<float, choroboros::kBlockRampChunkSamples> delays;
+    for (int start = 0; start < blockNumSamples; start += choroboros::kBlockRampChunkSamples)
     {
-        auto* inputSamples = block.getChannelPointer(ch);
-        auto* outputSamples = block.getChannelPointer(ch);
-        auto& buffer = delayBuffers[static_cast<size_t>(ch)];
-        int& writePos = writePositions[static_cast<size_t>(ch)];
-        auto& state = phaseStates[static_cast<size_t>(ch)];
-        auto& delaySmoother = delaySmoothers[static_cast<size_t>(ch)];
-        
-        // Initialize delay on first sample if needed
-        if (!state.initialized)
-        {
-            float initialMod = computeWarpedModulation(state.phase, warpA, warpB, warpK);
-            float initialDelay = centreDelaySamples + depthSamples * initialMod;
-            initialDelay = juce::jlimit(guardSamples, maxDelaySamples, initialDelay);
-            state.smoothedDelay = initialDelay;
-            delaySmoother.setCurrentAndTargetValue(initialDelay);
-            state.initialized = true;
-        }
-        
-        for (int i = 0; i < blockNumSamples; ++i)
+        const int chunk = juce::jmin(choroboros::kBlockRampChunkSamples, blockNumSamples - start);
+
+        for (int i = 0; i < chunk; ++i)
         {
-            const float in = inputSamples[i];
-            
-            // Write to buffer
-            buffer[static_cast<size_t>(writePos)] = in;
-            writePos = (writePos + 1) & bufferMask;
-            
             // Advance phase
             state.phase += phaseInc;
             if (state.phase >= 1.0f)
                 state.phase -= 1.0f;
-            
+
             // Compute warped modulation
             float mod = computeWarpedModulation(state.phase, warpA, warpB, warpK);
-            
+
             // Calculate target delay
             float targetDelay = centreDelaySamples + depthSamples * mod;
-            targetDelay = juce::jlimit(guardSamples, maxDelaySamples, targetDelay);
-            
-            // Smooth delay (20ms ramp)
-            delaySmoother.setTargetValue(targetDelay);
-            float delaySamp = delaySmoother.getNextValue();
-            
+            delays[static_cast<size_t>(i)] = juce::jlimit(guardSamples, maxDelaySamples, targetDelay);
+        }
+
+        // Smooth delay (20ms ramp)
+        delaySmoother.process(delays.data(), delays.data(), chunk);
+
+        for (int i = 0; i < chunk; ++i)
+        {
+            // Input is already in the shared history; step past it
+            writePos = (writePos + 1) & historyMask;
+
             // Read with cubic interpolation
-            const float out = readCubic(ch, delaySamp);
-            outputSamples[i] = out;
+            outputSamples[start + i] = readCubic(history, historyMask, writePos, delays[static_cast<size_t>(i)]);
         }
     }
 }
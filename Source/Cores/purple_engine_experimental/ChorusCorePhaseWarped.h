@@ -19,6 +19,7 @@
 #pragma once
 
 #include "../ChorusCore.h"
+#include "../../DSP/BlockRamp.h"
 #include <vector>
 
 // Phase-Warped Chorus core
@@ -33,15 +34,17 @@ public:
     void prepare(const juce::dsp::ProcessSpec& spec, ChorusDSP* dsp = nullptr) override;
     void reset() override;
     void processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs) override;
+    bool supportsChannelParallelism() const override { return true; }
+    void beginDelayBlock(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs) override;
+    void processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel) override;
     
     float getGuardSamples() const override { return 2.0f; } // Cubic interpolation needs 2 samples
     float getMaxDelaySamples() const override;
+    int getSharedHistorySamples() const override { return historySamples; }
+    void resumeFromSharedHistory() override;
     
 private:
-    std::vector<std::vector<float>> delayBuffers; // Per-channel circular buffers
-    std::vector<int> writePositions;
-    int bufferSize = 0;
-    int bufferMask = 0; // For power-of-2 size
+    int historySamples = 0; // Delay memory is ChorusDSP's shared input history
     juce::dsp::ProcessSpec spec;
     int maxDelaySamples = 0;
     
@@ -55,11 +58,11 @@ private:
     std::vector<PhaseState> phaseStates;
     
     // Delay smoothing (10-30ms ramp)
-    std::vector<juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear>> delaySmoothers;
+    std::vector<choroboros::OnePoleBlockRamp> delaySmoothers;
     float lastDelaySmoothingMs = -1.0f;
     
     // Cubic interpolation read (same as Blue Normal)
-    float readCubic(int channel, float delaySamples) const;
+    static float readCubic(const float* buf, int bufMask, int writePos, float delaySamples);
     
     // Compute warped phase modulation
     // Returns modulation signal m in range [-1, 1]
@@ -19,6 +19,7 @@
 #include "../../DSP/ChorusDSP.h"
 #include <cmath>
 #include <algorithm>
+#include <array>
 
 ChorusCoreBBD::ChorusCoreBBD()
 {
@@ -26,6 +27,7 @@ ChorusCoreBBD::ChorusCoreBBD()
 
 void ChorusCoreBBD::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusDSP* dsp)
 {
+    jassert(dsp != nullptr);
     spec = processSpec;
 
     constexpr float maximumDelayModulation = 20.0f;
@@ -57,7 +59,7 @@ void ChorusCoreBBD::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusDSP
     for (size_t ch = 0; ch < channels.size(); ++ch)
     {
         auto& chan = channels[ch];
-        chan.stages.assign(static_cast<size_t>(BBD_STAGES_MAX), 0.0f);
+        chan.stages = dsp->getDspArena().reserve(static_cast<size_t>(BBD_STAGES_MAX));
         chan.head = 0;
         chan.clockPhase = 0.0;
         chan.heldPrev = 0.0f;
@@ -95,8 +97,8 @@ float ChorusCoreBBD::getMaxDelaySamples() const
     return static_cast<float>(maxDelaySamples) - getGuardSamples();
 }
 
-float ChorusCoreBBD::processBBDChannel(int channel, float input, float clockFreq, float clockSmoothCoeff,
-                                       int effectiveStages)
+float ChorusCoreBBD::processBBDChannel(int channel, float* stages, float input, float clockFreq,
+                                       float clockSmoothCoeff, int effectiveStages)
 {
     auto& chan = channels[static_cast<size_t>(channel)];
 
@@ -121,12 +123,12 @@ float ChorusCoreBBD::processBBDChannel(int channel, float input, float clockFreq
 
         chan.clockPhase -= 1.0;
 
-        chan.stages[static_cast<size_t>(chan.head)] = toWrite;
+        stages[chan.head] = toWrite;
         chan.head = (chan.head + 1) % effectiveStages;
 
         int readPos = (chan.head - delayStages + effectiveStages) % effectiveStages;
         chan.heldPrev = chan.heldNext;
-        chan.heldNext = chan.stages[static_cast<size_t>(readPos)];
+        chan.heldNext = stages[readPos];
 
         chan.prevFilteredInput = filteredInput;
     }
@@ -142,12 +144,16 @@ float ChorusCoreBBD::processBBDChannel(int channel, float input, float clockFreq
 
 void ChorusCoreBBD::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
 {
+    beginDelayBlock(dsp, block, currentCentreDelayMs);
     const int numChannels = static_cast<int>(block.getNumChannels());
-    const int blockNumSamples = static_cast<int>(block.getNumSamples());
-    const auto& tuning = dsp.runtimeTuningSnapshot;
+    for (int ch = 0; ch < numChannels; ++ch)
+        processDelayChannel(dsp, block, currentCentreDelayMs, ch);
+}
 
-    const float remappedCentreDelayMs = tuning.bbdCentreBaseMs + (currentCentreDelayMs - 8.0f) * tuning.bbdCentreScale;
-    const float depthMs = tuning.bbdDepthMs;
+void ChorusCoreBBD::beginDelayBlock(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
+{
+    juce::ignoreUnused(block, currentCentreDelayMs);
+    const auto& tuning = dsp.runtimeTuningSnapshot;
 
     const float delaySmoothingMs = juce::jmax(0.0f, tuning.bbdDelaySmoothingMs);
     if (delaySmoothingMs != lastDelaySmoothingMs)
@@ -161,25 +167,32 @@ void ChorusCoreBBD::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& b
         }
         lastDelaySmoothingMs = delaySmoothingMs;
     }
+}
+
+ChorusCoreBBD::BlockSettings ChorusCoreBBD::computeBlockSettings(const ChorusDSP& dsp, float currentCentreDelayMs,
+                                                                 float sampleRate, int blockNumSamples)
+{
+    const auto& tuning = dsp.runtimeTuningSnapshot;
+    BlockSettings settings;
+
+    settings.remappedCentreDelayMs = tuning.bbdCentreBaseMs + (currentCentreDelayMs - 8.0f) * tuning.bbdCentreScale;
+    settings.depthMs = tuning.bbdDepthMs;
 
     const float clockSmoothMs = juce::jmax(0.001f, tuning.bbdClockSmoothingMs);
-    const float clockSmoothCoeff = std::exp(-1.0f / (clockSmoothMs * 0.001f * static_cast<float>(spec.sampleRate)));
-    const float clockMinHz = juce::jmax(20.0f, tuning.bbdClockMinHz);
+    settings.clockSmoothCoeff = std::exp(-1.0f / (clockSmoothMs * 0.001f * sampleRate));
+    settings.clockMinHz = juce::jmax(20.0f, tuning.bbdClockMinHz);
     const float clockMaxRatio = juce::jlimit(0.05f, 1.0f, tuning.bbdClockMaxRatio);
-    const int effectiveStages = juce::jlimit(256, 2048, static_cast<int>(tuning.bbdStages));
-
-    auto* lfoLeft = dsp.lfoBuffer.getReadPointer(0);
-    auto* lfoRight = (numChannels >= 2) ? dsp.cosBuffer.getReadPointer(0) : lfoLeft;
+    settings.effectiveStages = juce::jlimit(256, 2048, static_cast<int>(tuning.bbdStages));
 
-    const float fs = static_cast<float>(spec.sampleRate);
+    const float fs = sampleRate;
     // BBD clock is explicitly capped at sample rate (not an extra 0.45*fs ceiling),
     // matching the intended model and avoiding hidden modulation clipping.
     const float nyquistSafeClock = fs;
     const float ratioClockLimit = fs * clockMaxRatio;
-    const float maxClockFreq = juce::jmax(clockMinHz + 1.0f, juce::jmin(nyquistSafeClock, ratioClockLimit));
-    const float effectiveMinDelayMs = (static_cast<float>(effectiveStages) / (2.0f * maxClockFreq)) * 1000.0f;
-    const float delayMinMs = juce::jmax(tuning.bbdDelayMinMs, effectiveMinDelayMs);
-    const float delayMaxMs = juce::jmax(delayMinMs, tuning.bbdDelayMaxMs);
+    settings.maxClockFreq = juce::jmax(settings.clockMinHz + 1.0f, juce::jmin(nyquistSafeClock, ratioClockLimit));
+    const float effectiveMinDelayMs = (static_cast<float>(settings.effectiveStages) / (2.0f * settings.maxClockFreq)) * 1000.0f;
+    settings.delayMinMs = juce::jmax(tuning.bbdDelayMinMs, effectiveMinDelayMs);
+    settings.delayMaxMs = juce::jmax(settings.delayMinMs, tuning.bbdDelayMaxMs);
 
     const float filterMinHz = juce::jmax(20.0f, tuning.bbdFilterCutoffMinHz);
     const float filterMaxHz = juce::jmax(filterMinHz, tuning.bbdFilterCutoffMaxHz);
@@ -187,63 +200,79 @@ void ChorusCoreBBD::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& b
     const float filterMaxByRatioHz = fs * filterMaxRatio;
     const float effectiveFilterMaxHz = juce::jmax(filterMinHz, juce::jmin(filterMaxHz, filterMaxByRatioHz));
     const float filterScale = juce::jmax(0.0f, tuning.bbdFilterCutoffScale);
-    const float centreDelayMsForFilter = juce::jlimit(delayMinMs, delayMaxMs, remappedCentreDelayMs);
+    const float centreDelayMsForFilter = juce::jlimit(settings.delayMinMs, settings.delayMaxMs, settings.remappedCentreDelayMs);
     const float centreDelaySecForFilter = juce::jmax(0.001f, centreDelayMsForFilter * 0.001f);
-    float approxClockHz = static_cast<float>(effectiveStages) / (2.0f * centreDelaySecForFilter);
+    float approxClockHz = static_cast<float>(settings.effectiveStages) / (2.0f * centreDelaySecForFilter);
     approxClockHz = juce::jmin(approxClockHz, fs);
-    approxClockHz = juce::jlimit(clockMinHz, maxClockFreq, approxClockHz);
-    const float targetFilterCutoffHz = juce::jlimit(filterMinHz, effectiveFilterMaxHz, filterScale * approxClockHz);
+    approxClockHz = juce::jlimit(settings.clockMinHz, settings.maxClockFreq, approxClockHz);
+    settings.targetFilterCutoffHz = juce::jlimit(filterMinHz, effectiveFilterMaxHz, filterScale * approxClockHz);
 
-    const float filterSmoothMs = juce::jmax(0.0f, tuning.bbdFilterSmoothingMs);
+    settings.filterSmoothMs = juce::jmax(0.0f, tuning.bbdFilterSmoothingMs);
     const float blockSeconds = static_cast<float>(blockNumSamples) / fs;
-    const float filterBlockCoeff = (filterSmoothMs > 0.0f)
-        ? std::exp(-blockSeconds / (filterSmoothMs * 0.001f))
+    settings.filterBlockCoeff = (settings.filterSmoothMs > 0.0f)
+        ? std::exp(-blockSeconds / (settings.filterSmoothMs * 0.001f))
         : 0.0f;
+    return settings;
+}
 
-    for (int ch = 0; ch < numChannels; ++ch)
-    {
-        auto* inputSamples = block.getChannelPointer(ch);
-        auto* outputSamples = block.getChannelPointer(ch);
-        const float* channelLfo = (ch == 0) ? lfoLeft : lfoRight;
+void ChorusCoreBBD::updateBandwidthFilters(const BlockSettings& settings, float sampleRate,
+                                           float& smoothedCutoffHz, float& lastDesignedCutoffHz,
+                                           choroboros::BBDCascadeFilter& inputFilter,
+                                           choroboros::BBDCascadeFilter& outputFilter)
+{
+    if (smoothedCutoffHz <= 0.0f || !std::isfinite(smoothedCutoffHz))
+        smoothedCutoffHz = settings.targetFilterCutoffHz;
 
-        auto& chan = channels[static_cast<size_t>(ch)];
+    if (settings.filterSmoothMs > 0.0f)
+        smoothedCutoffHz = settings.filterBlockCoeff * smoothedCutoffHz + (1.0f - settings.filterBlockCoeff) * settings.targetFilterCutoffHz;
+    else
+        smoothedCutoffHz = settings.targetFilterCutoffHz;
 
-        if (chan.smoothedFilterCutoffHz <= 0.0f || !std::isfinite(chan.smoothedFilterCutoffHz))
-            chan.smoothedFilterCutoffHz = targetFilterCutoffHz;
+    if (lastDesignedCutoffHz < 0.0f
+        || std::abs(smoothedCutoffHz - lastDesignedCutoffHz) >= 1.0f)
+    {
+        // Local coefficients: channels may be redesigned concurrently.
+        const auto channelCoeffs = choroboros::designBBD5thOrderButterworth(smoothedCutoffHz, sampleRate);
+        inputFilter.setCoeffs(channelCoeffs);
+        outputFilter.setCoeffs(channelCoeffs);
+        lastDesignedCutoffHz = smoothedCutoffHz;
+    }
+}
 
-        if (filterSmoothMs > 0.0f)
-            chan.smoothedFilterCutoffHz = filterBlockCoeff * chan.smoothedFilterCutoffHz + (1.0f - filterBlockCoeff) * targetFilterCutoffHz;
-        else
-            chan.smoothedFilterCutoffHz = targetFilterCutoffHz;
+void ChorusCoreBBD::processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel)
+{
+    const int blockNumSamples = static_cast<int>(block.getNumSamples());
+    const float fs = static_cast<float>(spec.sampleRate);
+    const auto settings = computeBlockSettings(dsp, currentCentreDelayMs, fs, blockNumSamples);
+    
+    auto* inputSamples = block.getChannelPointer(channel);
+    auto* outputSamples = block.getChannelPointer(channel);
+    const float* channelLfo = dsp.getChannelLfo(channel);
 
-        if (chan.lastDesignedFilterCutoffHz < 0.0f
-            || std::abs(chan.smoothedFilterCutoffHz - chan.lastDesignedFilterCutoffHz) >= 1.0f)
-        {
-            filterCoeffs = choroboros::designBBD5thOrderButterworth(chan.smoothedFilterCutoffHz, fs);
-            chan.inputFilter.setCoeffs(filterCoeffs);
-            chan.outputFilter.setCoeffs(filterCoeffs);
-            chan.lastDesignedFilterCutoffHz = chan.smoothedFilterCutoffHz;
-        }
+    auto& chan = channels[static_cast<size_t>(channel)];
+    updateBandwidthFilters(settings, fs, chan.smoothedFilterCutoffHz, chan.lastDesignedFilterCutoffHz,
+                           chan.inputFilter, chan.outputFilter);
+
+    // Delay targets are built and smoothed a chunk at a time; only the BBD itself runs per sample.
+    // The stage span resolves through the arena, so take its pointer once for the whole block.
+    float* const stages = chan.stages.data();
+    std::array<float, choroboros::kBlockRampChunkSamples> delaysMs;
+    for (int start = 0; start < blockNumSamples; start += choroboros::kBlockRampChunkSamples)
+    {
+        const int chunk = juce::jmin(choroboros::kBlockRampChunkSamples, blockNumSamples - start);
+        juce::FloatVectorOperations::copyWithMultiply(delaysMs.data(), channelLfo + start, settings.depthMs, chunk);
+        juce::FloatVectorOperations::add(delaysMs.data(), settings.remappedCentreDelayMs, chunk);
+        juce::FloatVectorOperations::clip(delaysMs.data(), delaysMs.data(), settings.delayMinMs, settings.delayMaxMs, chunk);
+        chan.smoothedDelayMs.process(delaysMs.data(), delaysMs.data(), chunk);
 
-        for (int i = 0; i < blockNumSamples; ++i)
+        for (int i = 0; i < chunk; ++i)
         {
-            float targetDelayMs = remappedCentreDelayMs + depthMs * channelLfo[i];
-            targetDelayMs = juce::jlimit(delayMinMs, delayMaxMs, targetDelayMs);
-
-            chan.smoothedDelayMs.setTargetValue(targetDelayMs);
-            float delayMs = chan.smoothedDelayMs.getNextValue();
-
-            float delaySeconds = delayMs * 0.001f;
-            float clockFreq = static_cast<float>(effectiveStages) / (2.0f * delaySeconds);
-
             // Cap clock at sample rate (jpcima)
-            clockFreq = juce::jmin(clockFreq, fs);
-
-            clockFreq = juce::jlimit(clockMinHz, maxClockFreq, clockFreq);
+            const float clockFreq = clockForDelayMs(delaysMs[static_cast<size_t>(i)], settings, fs);
 
-            const float in = inputSamples[i];
-            const float out = processBBDChannel(ch, in, clockFreq, clockSmoothCoeff, effectiveStages);
-            outputSamples[i] = out;
+            const float in = inputSamples[start + i];
+            const float out = processBBDChannel(channel, stages, in, clockFreq, settings.clockSmoothCoeff, settings.effectiveStages);
+            outputSamples[start + i] = out;
         }
     }
 }
@@ -20,6 +20,8 @@
 
 #include "../ChorusCore.h"
 #include "../../DSP/BBDCascadeFilter.h"
+#include "../../DSP/BlockRamp.h"
+#include "../../DSP/DspArena.h"
 #include <vector>
 
 // Bucket-Brigade Device (BBD) emulation chorus core
@@ -33,16 +35,53 @@ public:
     void prepare(const juce::dsp::ProcessSpec& spec, ChorusDSP* dsp = nullptr) override;
     void reset() override;
     void processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs) override;
+    bool supportsChannelParallelism() const override { return true; }
+    void beginDelayBlock(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs) override;
+    void processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel) override;
     
     float getGuardSamples() const override { return 1.0f; }
     float getMaxDelaySamples() const override;
+
+    // Per-block clock, delay and bandwidth limits derived from the bbd* runtime tuning.
+    // ChorusCoreBBDApprox uses the same derivation so both models track the same settings.
+    struct BlockSettings
+    {
+        float remappedCentreDelayMs = 0.0f;
+        float depthMs = 0.0f;
+        float clockSmoothCoeff = 0.0f;
+        float clockMinHz = 0.0f;
+        float maxClockFreq = 0.0f;
+        float delayMinMs = 0.0f;
+        float delayMaxMs = 0.0f;
+        int effectiveStages = 1024;
+        float targetFilterCutoffHz = 0.0f;
+        float filterSmoothMs = 0.0f;
+        float filterBlockCoeff = 0.0f;
+    };
+    static BlockSettings computeBlockSettings(const ChorusDSP& dsp, float currentCentreDelayMs,
+                                              float sampleRate, int blockNumSamples);
+
+    // Clock that gives the requested delay across effectiveStages / 2 ticks, capped at the sample rate.
+    static float clockForDelayMs(float delayMs, const BlockSettings& settings, float sampleRate)
+    {
+        const float delaySeconds = delayMs * 0.001f;
+        const float clockFreq = juce::jmin(static_cast<float>(settings.effectiveStages) / (2.0f * delaySeconds), sampleRate);
+        return juce::jlimit(settings.clockMinHz, settings.maxClockFreq, clockFreq);
+    }
+
+    // Smooths the anti-aliasing/reconstruction cutoff once per block and redesigns both
+    // cascades only when it has moved by at least 1 Hz.
+    static void updateBandwidthFilters(const BlockSettings& settings, float sampleRate,
+                                       float& smoothedCutoffHz, float& lastDesignedCutoffHz,
+                                       choroboros::BBDCascadeFilter& inputFilter,
+                                       choroboros::BBDCascadeFilter& outputFilter);
     
 private:
     static constexpr int BBD_STAGES_MAX = 2048; // Max stages (allocate buffer this size)
     
     struct BBDChannel
     {
-        std::vector<float> stages; // BBD stage buffer
+        choroboros::ArenaSpan stages; // BBD stage buffer
         int head = 0;
         double clockPhase = 0.0;
         float heldPrev = 0.0f;  // Previous held output for time interpolation
@@ -52,7 +91,7 @@ private:
         choroboros::BBDCascadeFilter inputFilter;
         choroboros::BBDCascadeFilter outputFilter;
 
-        juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothedDelayMs;
+        choroboros::OnePoleBlockRamp smoothedDelayMs; // retargeted every sample
         float smoothedClockFreq = 5000.0f;
         float smoothedFilterCutoffHz = 4000.0f;
         float lastDesignedFilterCutoffHz = -1.0f;
@@ -62,9 +101,9 @@ private:
     juce::dsp::ProcessSpec spec;
     int maxDelaySamples = 0;
     
-    // Process one channel's BBD
-    float processBBDChannel(int channel, float input, float clockFreq, float clockSmoothCoeff,
-                            int effectiveStages);
+    // Process one channel's BBD; stages is that channel's stage buffer, resolved once per block
+    float processBBDChannel(int channel, float* stages, float input, float clockFreq,
+                            float clockSmoothCoeff, int effectiveStages);
 
     choroboros::BBD5thOrderButterworthCoeffs filterCoeffs;
 
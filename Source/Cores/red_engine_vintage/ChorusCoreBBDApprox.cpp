@@ -0,0 +1,273 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ChorusCoreBBDApprox.h"
+#include "ChorusCoreBBD.h"
+#include "../../DSP/ChorusDSP.h"
+#include <cmath>
+#include <algorithm>
+
+ChorusCoreBBDApprox::ChorusCoreBBDApprox()
+{
+}
+
+void ChorusCoreBBDApprox::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusDSP* dsp)
+{
+    spec = processSpec;
+
+    constexpr float maximumDelayModulation = 20.0f;
+    constexpr float oscVolumeMultiplier = 0.5f;
+    constexpr float maxDepth = 1.0f;
+    constexpr float maxCentreDelayMs = 100.0f;
+    constexpr int guardMarginSamples = 4;
+
+    maxDelaySamples = static_cast<int>(std::ceil(
+        (maximumDelayModulation * maxDepth * oscVolumeMultiplier + maxCentreDelayMs)
+        * spec.sampleRate / 1000.0)) + guardMarginSamples;
+
+    historySamples = maxDelaySamples + 4; // +4 for cubic interpolation
+
+    channels.resize(static_cast<size_t>(spec.numChannels));
+
+    // Same starting cutoff as ChorusCoreBBD: 0.5 * the slowest clock the tuning allows.
+    float maxDelaySec = 0.1f;
+    int stages = 1024;
+    if (dsp != nullptr)
+    {
+        maxDelaySec = juce::jmax(0.001f, dsp->getRuntimeTuning().bbdDelayMaxMs.load() * 0.001f);
+        stages = juce::jlimit(256, 2048, static_cast<int>(dsp->getRuntimeTuning().bbdStages.load()));
+    }
+    const float minClockHz = static_cast<float>(stages) / (2.0f * maxDelaySec);
+    const float cutoffHz = juce::jlimit(500.0f, static_cast<float>(spec.sampleRate) * 0.4f, 0.5f * minClockHz);
+    const auto filterCoeffs = choroboros::designBBD5thOrderButterworth(cutoffHz, static_cast<float>(spec.sampleRate));
+
+    for (auto& chan : channels)
+    {
+        resetChannel(chan);
+        chan.inputFilter.setCoeffs(filterCoeffs);
+        chan.outputFilter.setCoeffs(filterCoeffs);
+        chan.smoothedDelayMs = 20.0f;
+        chan.smoothedClockFreq = 5000.0f;
+        chan.smoothedFilterCutoffHz = cutoffHz;
+        chan.lastDesignedFilterCutoffHz = cutoffHz;
+    }
+    lastDelaySmoothingMs = -1.0f;
+}
+
+void ChorusCoreBBDApprox::resetChannel(ApproxChannel& chan)
+{
+    chan.inputFilter.reset();
+    chan.outputFilter.reset();
+    chan.droopX1 = 0.0f;
+    chan.droopX2 = 0.0f;
+    chan.droopY1 = 0.0f;
+    chan.initialized = false;
+}
+
+void ChorusCoreBBDApprox::reset()
+{
+    for (auto& chan : channels)
+    {
+        resetChannel(chan);
+        chan.smoothedClockFreq = 5000.0f;
+        chan.smoothedDelayMs = 20.0f;
+        chan.lastDesignedFilterCutoffHz = -1.0f;
+    }
+}
+
+void ChorusCoreBBDApprox::resumeFromSharedHistory()
+{
+    // Drop the filter tails from the last use and snap the clock to the current delay.
+    for (auto& chan : channels)
+        resetChannel(chan);
+}
+
+float ChorusCoreBBDApprox::getMaxDelaySamples() const
+{
+    return static_cast<float>(maxDelaySamples) - getGuardSamples();
+}
+
+ChorusCoreBBDApprox::HoldDroop ChorusCoreBBDApprox::holdDroopFor(float clockHz, float sampleRate)
+{
+    // The stage model linearly interpolates between clock ticks, a first-order hold whose
+    // response is sinc^2(f / clock) ~ 1 - (pi * f / clock)^2 / 3. The symmetric FIR matches that
+    // curvature down to clock = fs / sqrt(3); below that a one-pole supplies the remainder.
+    HoldDroop droop;
+    const float clockSq = clockHz * clockHz;
+    const float fsSq = sampleRate * sampleRate;
+    droop.firEdge = juce::jlimit(0.0f, 0.25f, fsSq / (12.0f * clockSq));
+
+    const float residual = 1.0f / (3.0f * clockSq) - 1.0f / fsSq;
+    if (residual > 0.0f)
+    {
+        const float poleHz = 1.0f / (juce::MathConstants<float>::pi * std::sqrt(2.0f * residual));
+        droop.pole = std::exp(-juce::MathConstants<float>::twoPi * poleHz / sampleRate);
+    }
+    droop.groupDelaySamples = 1.0f + droop.pole / (1.0f - droop.pole);
+    return droop;
+}
+
+float ChorusCoreBBDApprox::readCubic(const float* buf, int bufMask, float readPos)
+{
+    const int i1 = static_cast<int>(readPos);
+    const float u = readPos - static_cast<float>(i1); // Fractional part in [0,1)
+
+    const float pm1 = buf[static_cast<size_t>((i1 - 1) & bufMask)];
+    const float p0  = buf[static_cast<size_t>(i1 & bufMask)];
+    const float p1  = buf[static_cast<size_t>((i1 + 1) & bufMask)];
+    const float p2  = buf[static_cast<size_t>((i1 + 2) & bufMask)];
+
+    // Catmull-Rom cubic weights
+    const float u2 = u * u;
+    const float u3 = u2 * u;
+    const float w_m1 = 0.5f * (-u3 + 2.0f * u2 - u);
+    const float w_0  = 0.5f * ( 3.0f * u3 - 5.0f * u2 + 2.0f);
+    const float w_1  = 0.5f * (-3.0f * u3 + 4.0f * u2 + u);
+    const float w_2  = 0.5f * ( u3 - u2);
+
+    return w_m1 * pm1 + w_0 * p0 + w_1 * p1 + w_2 * p2;
+}
+
+void ChorusCoreBBDApprox::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
+{
+    beginDelayBlock(dsp, block, currentCentreDelayMs);
+    const int numChannels = static_cast<int>(block.getNumChannels());
+    for (int ch = 0; ch < numChannels; ++ch)
+        processDelayChannel(dsp, block, currentCentreDelayMs, ch);
+}
+
+void ChorusCoreBBDApprox::beginDelayBlock(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
+{
+    juce::ignoreUnused(block, currentCentreDelayMs);
+    const auto& tuning = dsp.runtimeTuningSnapshot;
+
+    const float delaySmoothingMs = juce::jmax(0.0f, tuning.bbdDelaySmoothingMs);
+    if (delaySmoothingMs != lastDelaySmoothingMs)
+    {
+        // The stage model's delay ramp is a one-pole of 1 / steps per sample while the LFO moves;
+        // this is the same pole taken kControlInterval samples at a time.
+        const int steps = static_cast<int>(std::floor(delaySmoothingMs * 0.001 * spec.sampleRate));
+        delayControlCoeff = steps > 0
+            ? 1.0f - std::pow(1.0f - 1.0f / static_cast<float>(steps), static_cast<float>(kControlInterval))
+            : 1.0f;
+        lastDelaySmoothingMs = delaySmoothingMs;
+    }
+}
+
+void ChorusCoreBBDApprox::processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel)
+{
+    const int blockNumSamples = static_cast<int>(block.getNumSamples());
+    const float fs = static_cast<float>(spec.sampleRate);
+    const auto settings = ChorusCoreBBD::computeBlockSettings(dsp, currentCentreDelayMs, fs, blockNumSamples);
+
+    auto* samples = block.getChannelPointer(channel);
+    const float* channelLfo = dsp.getChannelLfo(channel);
+    const float* history = dsp.inputHistory[static_cast<size_t>(channel)].data();
+    const int historyMask = dsp.inputHistoryMask;
+    const float historySize = static_cast<float>(historyMask + 1);
+    const int blockStart = dsp.inputHistoryBlockStart;
+
+    auto& chan = channels[static_cast<size_t>(channel)];
+    ChorusCoreBBD::updateBandwidthFilters(settings, fs, chan.smoothedFilterCutoffHz, chan.lastDesignedFilterCutoffHz,
+                                          chan.inputFilter, chan.outputFilter);
+
+    // A sample spends effectiveStages / 2 clock ticks in the line.
+    const float transitTicksTimesFs = static_cast<float>(settings.effectiveStages / 2) * fs;
+    const float guardSamples = getGuardSamples();
+    const float maxReadDelaySamples = getMaxDelaySamples();
+    const HoldDroop droop = holdDroopFor(chan.smoothedClockFreq, fs);
+    const auto readDelayFor = [&](float transit)
+    {
+        // +1: the history write head sits one past the current sample.
+        return juce::jlimit(guardSamples, maxReadDelaySamples, transit - droop.groupDelaySamples + 1.0f);
+    };
+
+    if (!chan.initialized)
+    {
+        chan.smoothedDelayMs = juce::jlimit(settings.delayMinMs, settings.delayMaxMs,
+                                            settings.remappedCentreDelayMs + settings.depthMs * channelLfo[0]);
+        chan.smoothedClockFreq = ChorusCoreBBD::clockForDelayMs(chan.smoothedDelayMs, settings, fs);
+        chan.transitSamples = transitTicksTimesFs / chan.smoothedClockFreq;
+        chan.readDelaySamples = readDelayFor(chan.transitSamples);
+        chan.initialized = true;
+    }
+
+    // Delay, clock and transit are smooth at the LFO's rate, so they advance once per control
+    // interval and the read delay is interpolated linearly in between. A sample leaving the line
+    // has crossed it at the clock of roughly half a transit ago, so the transit time follows the
+    // clock through a one-pole of that time constant.
+    const float interval = static_cast<float>(kControlInterval);
+    const float clockCoeff = std::pow(settings.clockSmoothCoeff, interval);
+    const float transitCoeff = std::exp(-2.0f * interval / juce::jmax(1.0f, chan.transitSamples));
+    float smoothedDelayMs = chan.smoothedDelayMs;
+    float clockFreq = chan.smoothedClockFreq;
+    float transit = chan.transitSamples;
+    float readDelay = chan.readDelaySamples;
+
+    const float firEdge = droop.firEdge;
+    const float firCentre = 1.0f - 2.0f * firEdge;
+    const float pole = droop.pole;
+    float x1 = chan.droopX1;
+    float x2 = chan.droopX2;
+    float y1 = chan.droopY1;
+
+    for (int start = 0; start < blockNumSamples; start += kControlInterval)
+    {
+        const int count = juce::jmin(kControlInterval, blockNumSamples - start);
+        const float targetDelayMs = juce::jlimit(settings.delayMinMs, settings.delayMaxMs,
+                                                 settings.remappedCentreDelayMs + settings.depthMs * channelLfo[start + count - 1]);
+        smoothedDelayMs += (targetDelayMs - smoothedDelayMs) * delayControlCoeff;
+        const float targetClock = ChorusCoreBBD::clockForDelayMs(smoothedDelayMs, settings, fs);
+        clockFreq = clockCoeff * clockFreq + (1.0f - clockCoeff) * targetClock;
+        const float instantTransit = transitTicksTimesFs / clockFreq;
+        transit = instantTransit + transitCoeff * (transit - instantTransit);
+
+        const float endDelay = readDelayFor(transit);
+        const float delayStep = (endDelay - readDelay) / static_cast<float>(count);
+        // Read position relative to the write head, which advances one sample per output.
+        float readPos = static_cast<float>(blockStart + start) - readDelay;
+        const float readStep = 1.0f - delayStep;
+        if (readPos < 0.0f)
+            readPos += historySize;
+        for (int i = 0; i < count; ++i)
+        {
+            readPos += readStep;
+            if (readPos >= historySize)
+                readPos -= historySize;
+            const float x = readCubic(history, historyMask, readPos);
+            const float fir = firEdge * (x + x2) + firCentre * x1;
+            x2 = x1;
+            x1 = x;
+            y1 = fir + pole * (y1 - fir);
+            samples[start + i] = y1;
+        }
+        readDelay = endDelay;
+    }
+
+    chan.smoothedDelayMs = smoothedDelayMs;
+    chan.smoothedClockFreq = clockFreq;
+    chan.transitSamples = transit;
+    chan.readDelaySamples = readDelay;
+    chan.droopX1 = x1;
+    chan.droopX2 = x2;
+    chan.droopY1 = y1;
+
+    // The filters are linear and share coefficients, so both run after the delay.
+    chan.inputFilter.processBlock(samples, blockNumSamples);
+    chan.outputFilter.processBlock(samples, blockNumSamples);
+}
@@ -0,0 +1,93 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../ChorusCore.h"
+#include "../../DSP/BBDCascadeFilter.h"
+#include <vector>
+
+// Approximated Bucket-Brigade Device (BBD) chorus core
+// Assignable alternative to ChorusCoreBBD for dense sessions: no private stage buffer, no switch
+// warmup, and no per-tick work, so its cost does not follow the clock.
+// Same bbd* tuning, delay, clock and cutoff derivation as the stage-accurate model, but the
+// stages are replaced by a fractional read of the shared input history. Delay, clock and transit
+// advance once per control interval; the BBD's input and output cascades run after the read with
+// the same cached coefficients, and the clock's first-order hold becomes a small droop filter.
+class ChorusCoreBBDApprox : public ChorusCore
+{
+public:
+    ChorusCoreBBDApprox();
+    ~ChorusCoreBBDApprox() override = default;
+    
+    void prepare(const juce::dsp::ProcessSpec& spec, ChorusDSP* dsp = nullptr) override;
+    void reset() override;
+    void processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs) override;
+    bool supportsChannelParallelism() const override { return true; }
+    void beginDelayBlock(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs) override;
+    void processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel) override;
+    
+    float getGuardSamples() const override { return 2.0f; } // Cubic interpolation needs 2 samples
+    float getMaxDelaySamples() const override;
+    int getSharedHistorySamples() const override { return historySamples; }
+    void resumeFromSharedHistory() override;
+    
+private:
+    struct ApproxChannel
+    {
+        choroboros::BBDCascadeFilter inputFilter;
+        choroboros::BBDCascadeFilter outputFilter;
+
+        float smoothedDelayMs = 20.0f;  // Advanced once per control interval
+        float smoothedClockFreq = 5000.0f;
+        float transitSamples = 0.0f;    // Stage transit time, lagged like a sample crossing the line
+        float readDelaySamples = 0.0f;  // History read delay at the last control point
+        float smoothedFilterCutoffHz = 4000.0f;
+        float lastDesignedFilterCutoffHz = -1.0f;
+
+        // Hold droop filter state
+        float droopX1 = 0.0f;
+        float droopX2 = 0.0f;
+        float droopY1 = 0.0f;
+
+        bool initialized = false;
+    };
+
+    // First-order hold at the BBD clock, refreshed once per chunk from the smoothed clock.
+    struct HoldDroop
+    {
+        float firEdge = 0.0f;           // [edge, 1 - 2 * edge, edge]
+        float pole = 0.0f;              // One-pole for clocks below fs / sqrt(3)
+        float groupDelaySamples = 1.0f; // Taken off the read delay
+    };
+    static HoldDroop holdDroopFor(float clockHz, float sampleRate);
+
+    std::vector<ApproxChannel> channels;
+    int historySamples = 0; // Delay memory is ChorusDSP's shared input history
+    juce::dsp::ProcessSpec spec;
+    int maxDelaySamples = 0;
+    float lastDelaySmoothingMs = -1.0f;
+    float delayControlCoeff = 1.0f;
+    bool deferCascades = false;
+    static constexpr int kControlInterval = 16;
+
+    void resetChannel(ApproxChannel& chan);
+
+    // Catmull-Rom read at an absolute, already wrapped history position
+    static float readCubic(const float* buf, int bufMask, float readPos);
+};
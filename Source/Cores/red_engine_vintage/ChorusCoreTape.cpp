@@ -23,8 +23,9 @@
 
 ChorusCoreTape::ChorusCoreTape() {}
 
-void ChorusCoreTape::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusDSP*)
+void ChorusCoreTape::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusDSP* dsp)
 {
+    jassert(dsp != nullptr);
     spec = processSpec;
 
     constexpr float maxCentreDelayMs = 100.0f;
@@ -44,7 +45,7 @@ void ChorusCoreTape::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusDS
 
     for (size_t ch = 0; ch < static_cast<size_t>(spec.numChannels); ++ch)
     {
-        delayBuffers[ch].assign(static_cast<size_t>(bufferSize), 0.0f);
+        delayBuffers[ch] = dsp->getDspArena().reserve(static_cast<size_t>(bufferSize));
 
         auto& mod = tapeMod[ch];
         mod.wowFreq = 0.33f + 0.03f * static_cast<float>(ch);
@@ -53,7 +54,8 @@ void ChorusCoreTape::prepare(const juce::dsp::ProcessSpec& processSpec, ChorusDS
         mod.flutterDepth = 0.0011f + 0.0001f * static_cast<float>(ch);
     }
 
-    reset();
+    // Delay lines come zeroed from the arena commit, which happens after every core has prepared.
+    std::fill(writePositions.begin(), writePositions.end(), 0);
 }
 
 void ChorusCoreTape::reset()
@@ -123,11 +125,18 @@ float ChorusCoreTape::tapeSaturate(float sample, float drive) const
 
 void ChorusCoreTape::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
 {
+    beginDelayBlock(dsp, block, currentCentreDelayMs);
     const int numChannels = static_cast<int>(block.getNumChannels());
+    for (int ch = 0; ch < numChannels; ++ch)
+        processDelayChannel(dsp, block, currentCentreDelayMs, ch);
+}
+
+void ChorusCoreTape::beginDelayBlock(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
+{
     const int numSamples = static_cast<int>(block.getNumSamples());
     const auto& tuning = dsp.runtimeTuningSnapshot;
 
-    if (numChannels <= 0 || numSamples <= 0)
+    if (block.getNumChannels() == 0 || numSamples <= 0)
         return;
 
     const float sampleRate = static_cast<float>(spec.sampleRate);
@@ -152,132 +161,141 @@ void ChorusCoreTape::processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>&
         currentFixedDelay = a * currentFixedDelay + (1.0f - a) * targetDelay;
     }
 
-    const float depth = juce::jlimit(0.0f, 1.0f, dsp.smoothedDepthValue);
     const float color = juce::jlimit(0.0f, 1.0f, dsp.smoothedColor.getCurrentValue());
-
     float toneMax = tuning.tapeToneMaxHz;
     float toneMin = tuning.tapeToneMinHz;
     if (toneMin > toneMax)
         std::swap(toneMin, toneMax);
     const float targetToneCutoff = toneMax - (toneMax - toneMin) * color;
     smoothedToneCutoff += tuning.tapeToneSmoothingCoeff * (targetToneCutoff - smoothedToneCutoff);
+}
+
+void ChorusCoreTape::processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel)
+{
+    const int numChannels = static_cast<int>(block.getNumChannels());
+    const int numSamples = static_cast<int>(block.getNumSamples());
+    const auto& tuning = dsp.runtimeTuningSnapshot;
+
+    if (numChannels <= 0 || numSamples <= 0)
+        return;
+
+    const float sampleRate = static_cast<float>(spec.sampleRate);
+    const float guardSamples = getGuardSamples();
+    const float maxDelay = getMaxDelaySamples();
+    juce::ignoreUnused(currentCentreDelayMs);
+
+    const float depth = juce::jlimit(0.0f, 1.0f, dsp.smoothedDepthValue);
+    const float color = juce::jlimit(0.0f, 1.0f, dsp.smoothedColor.getCurrentValue());
     const float toneAmount = juce::jlimit(0.0f, 1.0f, color);
 
     constexpr float cutoffRecomputeThresholdHz = 5.0f;
 
-    auto* lfoLeft = dsp.lfoBuffer.getReadPointer(0);
-    // If stereo, use cosBuffer for right channel (quadrature LFO)
-    auto* lfoRight = (numChannels >= 2) ? dsp.cosBuffer.getReadPointer(0) : lfoLeft;
-
     // Drive increases with Color knob
     const float drive = 1.0f + tuning.tapeDriveScale * color;
-
-    for (int ch = 0; ch < numChannels; ++ch)
+    
+    auto* samples = block.getChannelPointer(channel);
+    float* const buffer = delayBuffers[static_cast<size_t>(channel)].data(); // resolved once per block
+    auto& resampler = resamplers[static_cast<size_t>(channel)];
+    auto& mod = tapeMod[static_cast<size_t>(channel)];
+    auto& toneState = toneLPState[static_cast<size_t>(channel)];
+    int& writePos = writePositions[static_cast<size_t>(channel)];
+    const float* channelLfo = dsp.getChannelLfo(channel);
+    mod.wowFreq = tuning.tapeWowFreqBase + tuning.tapeWowFreqSpread * static_cast<float>(channel);
+    mod.flutterFreq = tuning.tapeFlutterFreqBase + tuning.tapeFlutterFreqSpread * static_cast<float>(channel);
+    mod.wowDepth = tuning.tapeWowDepthBase + tuning.tapeWowDepthSpread * static_cast<float>(channel);
+    mod.flutterDepth = tuning.tapeFlutterDepthBase + tuning.tapeFlutterDepthSpread * static_cast<float>(channel);
+
+    for (int i = 0; i < numSamples; ++i)
     {
-        auto* samples = block.getChannelPointer(ch);
-        auto& buffer = delayBuffers[static_cast<size_t>(ch)];
-        auto& resampler = resamplers[static_cast<size_t>(ch)];
-        auto& mod = tapeMod[static_cast<size_t>(ch)];
-        auto& toneState = toneLPState[static_cast<size_t>(ch)];
-        int& writePos = writePositions[static_cast<size_t>(ch)];
-        const float* channelLfo = (ch == 0) ? lfoLeft : lfoRight;
-        mod.wowFreq = tuning.tapeWowFreqBase + tuning.tapeWowFreqSpread * static_cast<float>(ch);
-        mod.flutterFreq = tuning.tapeFlutterFreqBase + tuning.tapeFlutterFreqSpread * static_cast<float>(ch);
-        mod.wowDepth = tuning.tapeWowDepthBase + tuning.tapeWowDepthSpread * static_cast<float>(ch);
-        mod.flutterDepth = tuning.tapeFlutterDepthBase + tuning.tapeFlutterDepthSpread * static_cast<float>(ch);
-
-        for (int i = 0; i < numSamples; ++i)
+        const float in = samples[i];
+
+        // 1. Calculate Modulation (Tape Wow/Flutter)
+        mod.wowPhase += mod.wowFreq / sampleRate;
+        mod.flutterPhase += mod.flutterFreq / sampleRate;
+        if (mod.wowPhase >= 1.0f) mod.wowPhase -= 1.0f;
+        if (mod.flutterPhase >= 1.0f) mod.flutterPhase -= 1.0f;
+
+        const float wow = std::sin(juce::MathConstants<float>::twoPi * mod.wowPhase) * mod.wowDepth * depth;
+        const float flutter = std::sin(juce::MathConstants<float>::twoPi * mod.flutterPhase) * mod.flutterDepth * depth;
+
+        // 2. LFO Modulation
+        // The LFO buffer from ChorusDSP is typically scaled to ±0.5 max amplitude (controlled by depth).
+        // We need to scale this to a pitch ratio deviation.
+        // A classic chorus might have ±1% speed variation (~16 cents).
+        // 0.5 * 0.02 = 0.01 (1%).
+        // Increased from 0.006 to 0.02 to ensure audible classic chorus effect.
+        const float targetLfoMod = channelLfo[i] * tuning.tapeLfoRatioScale;
+        // Very slow response to suppress zipper when Depth changes quickly.
+        resampler.smoothedLfoMod += tuning.tapeLfoModSmoothingCoeff * (targetLfoMod - resampler.smoothedLfoMod);
+
+        // Target Ratio: 1.0 = normal speed
+        float targetRatio = 1.0f + resampler.smoothedLfoMod + wow + flutter;
+        
+        // Limit ratio to prevent extreme pitch shifts or instability
+        // ±2% is plenty for even extreme chorus
+        float ratioMin = tuning.tapeRatioMin;
+        float ratioMax = tuning.tapeRatioMax;
+        if (ratioMin > ratioMax)
+            std::swap(ratioMin, ratioMax);
+        targetRatio = juce::jlimit(ratioMin, ratioMax, targetRatio);
+
+        // Smooth the ratio to avoid zipper noise from rapid LFO/Wow changes
+        // Slower ratio tracking to further de-emphasize fast control transients.
+        resampler.smoothedRatio += tuning.tapeRatioSmoothingCoeff * (targetRatio - resampler.smoothedRatio);
+
+        // 3. Integrate Varispeed to get Position Offset
+        // If ratio > 1.0, we consume samples faster, so read head moves closer to write head (delay decreases).
+        // Integration: Position += Velocity * dt.
+        // Our "Velocity" relative to write head is (1.0 - ratio).
+        resampler.phaseOffset += (1.0f - resampler.smoothedRatio);
+
+        // Leaky Integrator / Spring
+        // This pulls the read head back to the center delay time.
+        // If too strong, it kills the LFO drift. If too weak, it drifts too far.
+        // 0.99998 lets it drift ~50x more than 0.999.
+        // Tuned for ~1-2 Hz LFOs to allow sufficient excursion.
+        resampler.phaseOffset *= tuning.tapePhaseDamping;
+
+        // 4. Calculate Read Pulse
+        float effectiveDelay = currentFixedDelay + resampler.phaseOffset;
+        
+        // Clamp delay to buffer bounds (safety)
+        // If the integrator allows too much drift, this hard limit saves us.
+        effectiveDelay = juce::jlimit(guardSamples, maxDelay, effectiveDelay);
+
+        // Update phaseOffset to reflect the clampling (anti-windup)
+        resampler.phaseOffset = effectiveDelay - currentFixedDelay;
+
+        float readPos = static_cast<float>(writePos) - effectiveDelay;
+        while (readPos < 0.0f)
+            readPos += static_cast<float>(bufferSize);
+        while (readPos >= static_cast<float>(bufferSize))
+            readPos -= static_cast<float>(bufferSize);
+
+        // 5. Read & Interpolate
+        float wet = resampleHermite(buffer, bufferMask, readPos, tuning.tapeHermiteTension);
+
+        // Apply Tape Tone (2-pole cascaded one-pole LP, no allocation)
+        const float cutoff = juce::jlimit(20.0f, 0.49f * sampleRate, smoothedToneCutoff);
+        if (std::abs(cutoff - toneState.cachedCutoffHz) > cutoffRecomputeThresholdHz || toneState.cachedCutoffHz < 0.0f)
         {
-            const float in = samples[i];
-
-            // 1. Calculate Modulation (Tape Wow/Flutter)
-            mod.wowPhase += mod.wowFreq / sampleRate;
-            mod.flutterPhase += mod.flutterFreq / sampleRate;
-            if (mod.wowPhase >= 1.0f) mod.wowPhase -= 1.0f;
-            if (mod.flutterPhase >= 1.0f) mod.flutterPhase -= 1.0f;
-
-            const float wow = std::sin(juce::MathConstants<float>::twoPi * mod.wowPhase) * mod.wowDepth * depth;
-            const float flutter = std::sin(juce::MathConstants<float>::twoPi * mod.flutterPhase) * mod.flutterDepth * depth;
-
-            // 2. LFO Modulation
-            // The LFO buffer from ChorusDSP is typically scaled to ±0.5 max amplitude (controlled by depth).
-            // We need to scale this to a pitch ratio deviation.
-            // A classic chorus might have ±1% speed variation (~16 cents).
-            // 0.5 * 0.02 = 0.01 (1%).
-            // Increased from 0.006 to 0.02 to ensure audible classic chorus effect.
-            const float targetLfoMod = channelLfo[i] * tuning.tapeLfoRatioScale;
-            // Very slow response to suppress zipper when Depth changes quickly.
-            resampler.smoothedLfoMod += tuning.tapeLfoModSmoothingCoeff * (targetLfoMod - resampler.smoothedLfoMod);
-
-            // Target Ratio: 1.0 = normal speed
-            float targetRatio = 1.0f + resampler.smoothedLfoMod + wow + flutter;
-            
-            // Limit ratio to prevent extreme pitch shifts or instability
-            // ±2% is plenty for even extreme chorus
-            float ratioMin = tuning.tapeRatioMin;
-            float ratioMax = tuning.tapeRatioMax;
-            if (ratioMin > ratioMax)
-                std::swap(ratioMin, ratioMax);
-            targetRatio = juce::jlimit(ratioMin, ratioMax, targetRatio);
-
-            // Smooth the ratio to avoid zipper noise from rapid LFO/Wow changes
-            // Slower ratio tracking to further de-emphasize fast control transients.
-            resampler.smoothedRatio += tuning.tapeRatioSmoothingCoeff * (targetRatio - resampler.smoothedRatio);
-
-            // 3. Integrate Varispeed to get Position Offset
-            // If ratio > 1.0, we consume samples faster, so read head moves closer to write head (delay decreases).
-            // Integration: Position += Velocity * dt.
-            // Our "Velocity" relative to write head is (1.0 - ratio).
-            resampler.phaseOffset += (1.0f - resampler.smoothedRatio);
-
-            // Leaky Integrator / Spring
-            // This pulls the read head back to the center delay time.
-            // If too strong, it kills the LFO drift. If too weak, it drifts too far.
-            // 0.99998 lets it drift ~50x more than 0.999.
-            // Tuned for ~1-2 Hz LFOs to allow sufficient excursion.
-            resampler.phaseOffset *= tuning.tapePhaseDamping;
-
-            // 4. Calculate Read Pulse
-            float effectiveDelay = currentFixedDelay + resampler.phaseOffset;
-            
-            // Clamp delay to buffer bounds (safety)
-            // If the integrator allows too much drift, this hard limit saves us.
-            effectiveDelay = juce::jlimit(guardSamples, maxDelay, effectiveDelay);
-
-            // Update phaseOffset to reflect the clampling (anti-windup)
-            resampler.phaseOffset = effectiveDelay - currentFixedDelay;
-
-            float readPos = static_cast<float>(writePos) - effectiveDelay;
-            while (readPos < 0.0f)
-                readPos += static_cast<float>(bufferSize);
-            while (readPos >= static_cast<float>(bufferSize))
-                readPos -= static_cast<float>(bufferSize);
-
-            // 5. Read & Interpolate
-            float wet = resampleHermite(buffer.data(), bufferMask, readPos, tuning.tapeHermiteTension);
-
-            // Apply Tape Tone (2-pole cascaded one-pole LP, no allocation)
-            const float cutoff = juce::jlimit(20.0f, 0.49f * sampleRate, smoothedToneCutoff);
-            if (std::abs(cutoff - toneState.cachedCutoffHz) > cutoffRecomputeThresholdHz || toneState.cachedCutoffHz < 0.0f)
-            {
-                toneState.cachedG = std::exp(-2.0f * juce::MathConstants<float>::pi * cutoff / sampleRate);
-                toneState.cachedCutoffHz = cutoff;
-            }
-            const float g = toneState.cachedG;
-            toneState.state1 = g * toneState.state1 + (1.0f - g) * wet;
-            toneState.state2 = g * toneState.state2 + (1.0f - g) * toneState.state1;
-            const float toned = toneState.state2;
-            // Keep Color at 0 as a neutral tape path and scale tone darkening with Color.
-            wet = wet + toneAmount * (toned - wet);
-            
-            // Mild makeup gain so tape modulation remains present at lower wet mixes.
-            samples[i] = wet * tuning.tapeWetGain;
-
-            // 6. Write to Buffer (Saturate input)
-            // Tape saturation happens on record (write)
-            buffer[static_cast<size_t>(writePos)] = tapeSaturate(in, drive);
-            
-            writePos = (writePos + 1) & bufferMask;
+            toneState.cachedG = std::exp(-2.0f * juce::MathConstants<float>::pi * cutoff / sampleRate);
+            toneState.cachedCutoffHz = cutoff;
         }
+        const float g = toneState.cachedG;
+        toneState.state1 = g * toneState.state1 + (1.0f - g) * wet;
+        toneState.state2 = g * toneState.state2 + (1.0f - g) * toneState.state1;
+        const float toned = toneState.state2;
+        // Keep Color at 0 as a neutral tape path and scale tone darkening with Color.
+        wet = wet + toneAmount * (toned - wet);
+        
+        // Mild makeup gain so tape modulation remains present at lower wet mixes.
+        samples[i] = wet * tuning.tapeWetGain;
+
+        // 6. Write to Buffer (Saturate input)
+        // Tape saturation happens on record (write)
+        buffer[writePos] = tapeSaturate(in, drive);
+        
+        writePos = (writePos + 1) & bufferMask;
     }
 }
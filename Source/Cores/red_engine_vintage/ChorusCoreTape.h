@@ -19,6 +19,7 @@
 #pragma once
 
 #include "../ChorusCore.h"
+#include "../../DSP/DspArena.h"
 #include <vector>
 
 // Tape chorus with varispeed-style modulation:
@@ -32,6 +33,9 @@ public:
     void prepare(const juce::dsp::ProcessSpec& spec, ChorusDSP* dsp = nullptr) override;
     void reset() override;
     void processDelay(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs) override;
+    bool supportsChannelParallelism() const override { return true; }
+    void beginDelayBlock(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs) override;
+    void processDelayChannel(ChorusDSP& dsp, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs, int channel) override;
 
     float getGuardSamples() const override { return 4.0f; }
     float getMaxDelaySamples() const override;
@@ -54,7 +58,7 @@ private:
         float flutterDepth = 0.0004f;
     };
 
-    std::vector<std::vector<float>> delayBuffers;
+    std::vector<choroboros::ArenaSpan> delayBuffers;
     std::vector<int> writePositions;
     std::vector<ResamplerState> resamplers;
     std::vector<TapeModState> tapeMod;
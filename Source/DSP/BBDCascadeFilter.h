@@ -66,6 +66,47 @@ public:
         return out2;
     }
 
+    // In-place block form of processSample(); the state is held in locals for the loop.
+    void processBlock(float* samples, int numSamples)
+    {
+        float fx1 = x1_fo, fy1 = y1_fo;
+        float ax1 = x1_b1, ax2 = x2_b1, ay1 = y1_b1, ay2 = y2_b1;
+        float bx1 = x1_b2, bx2 = x2_b2, by1 = y1_b2, by2 = y2_b2;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float x = samples[i];
+            const float y = fo.b0 * x + fo.b1 * fx1 - fo.a1 * fy1;
+            fx1 = x;
+            fy1 = y;
+
+            const float out1 = bq1.b0 * y + bq1.b1 * ax1 + bq1.b2 * ax2 - bq1.a1 * ay1 - bq1.a2 * ay2;
+            ax2 = ax1;
+            ax1 = y;
+            ay2 = ay1;
+            ay1 = out1;
+
+            const float out2 = bq2.b0 * out1 + bq2.b1 * bx1 + bq2.b2 * bx2 - bq2.a1 * by1 - bq2.a2 * by2;
+            bx2 = bx1;
+            bx1 = out1;
+            by2 = by1;
+            by1 = out2;
+
+            samples[i] = out2;
+        }
+
+        x1_fo = fx1;
+        y1_fo = fy1;
+        x1_b1 = ax1;
+        x2_b1 = ax2;
+        y1_b1 = ay1;
+        y2_b1 = ay2;
+        x1_b2 = bx1;
+        x2_b2 = bx2;
+        y1_b2 = by1;
+        y2_b2 = by2;
+    }
+
 private:
     BBDFirstOrderCoeffs fo;
     BBDBiquadCoeffs bq1;
@@ -62,11 +62,18 @@ inline BBD5thOrderButterworthCoeffs designBBD5thOrderButterworth(float fcHz, flo
     // k=0: theta=pi/10,  pole -sin(pi/10) + j*cos(pi/10)
     // k=1: theta=3pi/10, pole -sin(3pi/10) + j*cos(3pi/10)
     // k=2: theta=5pi/10, real pole at -1
-    constexpr double pi = juce::MathConstants<double>::pi;
-    const double s1 = std::sin(pi / 10.0);
-    const double c1 = std::cos(pi / 10.0);
-    const double s2 = std::sin(3.0 * pi / 10.0);
-    const double c2 = std::cos(3.0 * pi / 10.0);
+    // The prototype never changes, so it is evaluated once per process rather than per redesign.
+    struct PrototypePoles { double s1, c1, s2, c2; };
+    static const PrototypePoles poles = []
+    {
+        constexpr double pi = juce::MathConstants<double>::pi;
+        return PrototypePoles { std::sin(pi / 10.0), std::cos(pi / 10.0),
+                                std::sin(3.0 * pi / 10.0), std::cos(3.0 * pi / 10.0) };
+    }();
+    const double s1 = poles.s1;
+    const double c1 = poles.c1;
+    const double s2 = poles.s2;
+    const double c2 = poles.c2;
 
     // Real pole at -1: a = 1
     const float a = 1.0f;
@@ -0,0 +1,190 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+namespace choroboros
+{
+// Stack scratch size callers use when filling ramps chunk by chunk (no per-block allocation).
+static constexpr int kBlockRampChunkSamples = 256;
+
+// Drop-in for juce::SmoothedValue<float, Linear> in per-sample loops.
+// Same semantics: setTargetValue() restarts a stepsToTarget-long countdown only when the
+// target changes and the last step lands exactly on the target. fill() writes
+// start + step * (i + 1) for the whole ramp in one pass, which vectorises, instead of
+// accumulating one getNextValue() at a time.
+class LinearBlockRamp
+{
+public:
+    void reset(double sampleRate, double rampSeconds) noexcept
+    {
+        stepsToTarget = (sampleRate > 0.0 && rampSeconds > 0.0)
+            ? static_cast<int>(std::floor(rampSeconds * sampleRate))
+            : 0;
+        setCurrentAndTargetValue(target);
+    }
+
+    void setCurrentAndTargetValue(float newValue) noexcept
+    {
+        target = current = newValue;
+        countdown = 0;
+    }
+
+    void setTargetValue(float newValue) noexcept
+    {
+        if (newValue == target)
+            return;
+        if (stepsToTarget <= 0)
+        {
+            setCurrentAndTargetValue(newValue);
+            return;
+        }
+        target = newValue;
+        countdown = stepsToTarget;
+        step = (target - current) / static_cast<float>(countdown);
+    }
+
+    float getCurrentValue() const noexcept { return current; }
+    float getTargetValue() const noexcept { return target; }
+    bool isSmoothing() const noexcept { return countdown > 0; }
+
+    float getNextValue() noexcept
+    {
+        if (countdown <= 0)
+            return target;
+        --countdown;
+        current = (countdown > 0) ? current + step : target;
+        return current;
+    }
+
+    float skip(int numSamples) noexcept
+    {
+        if (numSamples >= countdown)
+        {
+            setCurrentAndTargetValue(target);
+            return target;
+        }
+        current += step * static_cast<float>(numSamples);
+        countdown -= numSamples;
+        return current;
+    }
+
+    // Writes the next numSamples values (what numSamples getNextValue() calls would return).
+    void fill(float* dest, int numSamples) noexcept
+    {
+        int i = 0;
+        if (countdown > 0 && numSamples > 0)
+        {
+            const int ramped = std::min(numSamples, countdown);
+            const float start = current;
+            const float inc = step;
+            for (; i < ramped; ++i)
+                dest[i] = start + inc * static_cast<float>(i + 1);
+            countdown -= ramped;
+            if (countdown == 0)
+                dest[ramped - 1] = target;
+            current = dest[ramped - 1];
+        }
+        std::fill(dest + i, dest + std::max(i, numSamples), target);
+    }
+
+private:
+    float current = 0.0f;
+    float target = 0.0f;
+    float step = 0.0f;
+    int countdown = 0;
+    int stepsToTarget = 0;
+};
+
+// Follows a per-sample target buffer exactly like calling setTargetValue() + getNextValue()
+// on a SmoothedValue<float, Linear> every sample: each new target restarts a stepsToTarget-long
+// ramp from the current value. While the target keeps moving that is a one-pole lowpass with
+// coefficient 1 / stepsToTarget; a repeated target finishes the running ramp linearly.
+// The recurrence stays serial, but it runs in registers; each retarget divides by stepsToTarget
+// the way SmoothedValue::setStepSize() does, so rounding matches too.
+class OnePoleBlockRamp
+{
+public:
+    void reset(double sampleRate, double rampSeconds) noexcept
+    {
+        stepsToTarget = (sampleRate > 0.0 && rampSeconds > 0.0)
+            ? static_cast<int>(std::floor(rampSeconds * sampleRate))
+            : 0;
+        setCurrentAndTargetValue(target);
+    }
+
+    void setCurrentAndTargetValue(float newValue) noexcept
+    {
+        target = current = newValue;
+        countdown = 0;
+    }
+
+    float getCurrentValue() const noexcept { return current; }
+    float getTargetValue() const noexcept { return target; }
+
+    // dest may alias targets.
+    void process(const float* targets, float* dest, int numSamples) noexcept
+    {
+        if (numSamples <= 0)
+            return;
+        if (stepsToTarget <= 0)
+        {
+            if (dest != targets)
+                std::copy(targets, targets + numSamples, dest);
+            setCurrentAndTargetValue(targets[numSamples - 1]);
+            return;
+        }
+
+        float value = current;
+        float goal = target;
+        float inc = step;
+        int remaining = countdown;
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float next = targets[i];
+            if (next != goal)
+            {
+                goal = next;
+                remaining = stepsToTarget;
+                inc = (goal - value) / static_cast<float>(stepsToTarget);
+            }
+            if (remaining > 0)
+            {
+                --remaining;
+                value = (remaining > 0) ? value + inc : goal;
+            }
+            dest[i] = value;
+        }
+        current = value;
+        target = goal;
+        step = inc;
+        countdown = remaining;
+    }
+
+private:
+    float current = 0.0f;
+    float target = 0.0f;
+    float step = 0.0f;
+    int countdown = 0;
+    int stepsToTarget = 0;
+};
+} // namespace choroboros
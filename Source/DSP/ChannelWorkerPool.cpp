@@ -0,0 +1,148 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ChannelWorkerPool.h"
+#include <algorithm>
+
+namespace choroboros
+{
+ChannelWorkerPool::Worker::Worker(ChannelWorkerPool& ownerPool)
+    : juce::Thread("ChoroborosChannelWorker"),
+      pool(ownerPool)
+{
+}
+
+void ChannelWorkerPool::Worker::run()
+{
+    while (!threadShouldExit())
+    {
+        Batch* batch = nullptr;
+        int taskIndex = 0;
+        {
+            std::unique_lock<std::mutex> lock(pool.queueMutex);
+            pool.workAvailable.wait(lock, [this]
+            {
+                return pool.shuttingDown || !pool.pendingBatches.empty();
+            });
+            if (pool.shuttingDown)
+                return;
+
+            // Batches are retired as soon as their last task is claimed, so the front always has work.
+            batch = pool.pendingBatches.front();
+            if (!pool.claimTask(*batch, taskIndex))
+                continue;
+        }
+
+        batch->function(batch->context, taskIndex);
+        pool.finishTask(*batch);
+    }
+}
+
+ChannelWorkerPool::ChannelWorkerPool()
+{
+    const int numWorkers = juce::jlimit(1, kMaxWorkers, juce::SystemStats::getNumCpus() - 1);
+    workers.reserve(static_cast<size_t>(numWorkers));
+    for (int i = 0; i < numWorkers; ++i)
+    {
+        workers.push_back(std::make_unique<Worker>(*this));
+        workers.back()->startThread();
+    }
+}
+
+ChannelWorkerPool::~ChannelWorkerPool()
+{
+    {
+        const std::lock_guard<std::mutex> lock(queueMutex);
+        shuttingDown = true;
+    }
+    workAvailable.notify_all();
+
+    for (auto& worker : workers)
+        worker->stopThread(2000);
+}
+
+bool ChannelWorkerPool::claimTask(Batch& batch, int& outTaskIndex)
+{
+    if (batch.nextTask >= batch.numTasks)
+        return false;
+
+    outTaskIndex = batch.nextTask++;
+    if (batch.nextTask >= batch.numTasks)
+    {
+        const auto it = std::find(pendingBatches.begin(), pendingBatches.end(), &batch);
+        if (it != pendingBatches.end())
+            pendingBatches.erase(it);
+    }
+    return true;
+}
+
+void ChannelWorkerPool::finishTask(Batch& batch)
+{
+    // The submitting thread may destroy the batch as soon as remaining hits zero,
+    // so nothing below the decrement may touch it.
+    if (batch.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        const std::lock_guard<std::mutex> lock(queueMutex);
+        batchFinished.notify_all();
+    }
+}
+
+void ChannelWorkerPool::run(TaskFunction taskFunction, void* context, int numTasks)
+{
+    if (taskFunction == nullptr || numTasks <= 0)
+        return;
+
+    if (numTasks == 1 || workers.empty())
+    {
+        for (int i = 0; i < numTasks; ++i)
+            taskFunction(context, i);
+        return;
+    }
+
+    Batch batch;
+    batch.function = taskFunction;
+    batch.context = context;
+    batch.numTasks = numTasks;
+    batch.remaining.store(numTasks, std::memory_order_relaxed);
+
+    {
+        const std::lock_guard<std::mutex> lock(queueMutex);
+        pendingBatches.push_back(&batch);
+    }
+    workAvailable.notify_all();
+
+    // Help drain our own batch; workers pick up whatever we have not claimed yet.
+    for (;;)
+    {
+        int taskIndex = 0;
+        {
+            const std::lock_guard<std::mutex> lock(queueMutex);
+            if (!claimTask(batch, taskIndex))
+                break;
+        }
+        taskFunction(context, taskIndex);
+        finishTask(batch);
+    }
+
+    std::unique_lock<std::mutex> lock(queueMutex);
+    batchFinished.wait(lock, [&batch]
+    {
+        return batch.remaining.load(std::memory_order_acquire) == 0;
+    });
+}
+} // namespace choroboros
@@ -0,0 +1,87 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace choroboros
+{
+// Small process-wide pool used to fan per-channel core work out during offline renders.
+// Shared by every plugin instance via juce::SharedResourcePointer. Each caller submits a
+// batch of independent tasks, claims tasks from it alongside the workers, and only returns
+// once every task of its batch has finished. Idle workers steal unclaimed tasks from any
+// instance's batch, so a handful of heavy instances still spread across cores.
+//
+// Not for the realtime path: submission takes a mutex and may block on a condition variable.
+class ChannelWorkerPool
+{
+public:
+    using TaskFunction = void (*)(void* context, int taskIndex);
+
+    ChannelWorkerPool();
+    ~ChannelWorkerPool();
+
+    // Run taskFunction(context, i) for i in [0, numTasks) and wait for all of them.
+    void run(TaskFunction taskFunction, void* context, int numTasks);
+
+    int getNumWorkers() const { return static_cast<int>(workers.size()); }
+
+private:
+    struct Batch
+    {
+        TaskFunction function = nullptr;
+        void* context = nullptr;
+        int numTasks = 0;
+        int nextTask = 0; // guarded by queueMutex
+        std::atomic<int> remaining { 0 };
+    };
+
+    class Worker : public juce::Thread
+    {
+    public:
+        explicit Worker(ChannelWorkerPool& ownerPool);
+        void run() override;
+
+    private:
+        ChannelWorkerPool& pool;
+    };
+
+    static constexpr int kMaxWorkers = 7;
+
+    // Claims the next task of a batch; retires the batch once its last task is claimed.
+    // Caller must hold queueMutex.
+    bool claimTask(Batch& batch, int& outTaskIndex);
+    void finishTask(Batch& batch);
+
+    std::mutex queueMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable batchFinished;
+    std::deque<Batch*> pendingBatches;
+    bool shuttingDown = false;
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ChannelWorkerPool)
+};
+} // namespace choroboros
@@ -19,17 +19,20 @@
 #include "ChorusDSP.h"
 #include "ChorusDSPPrepare.h"
 #include "ChorusDSPProcess.h"
+#include "QualityGovernor.h"
 #include "../Cores/ChorusCore.h"
 #include "../Cores/green_engine_classic/ChorusCoreLagrange3rd.h"
 #include "../Cores/green_engine_classic/ChorusCoreLagrange5th.h"
 #include "../Cores/blue_engine_modern/ChorusCoreCubic.h"
 #include "../Cores/blue_engine_modern/ChorusCoreThiran.h"
 #include "../Cores/red_engine_vintage/ChorusCoreBBD.h"
+#include "../Cores/red_engine_vintage/ChorusCoreBBDApprox.h"
 #include "../Cores/red_engine_vintage/ChorusCoreTape.h"
 #include "../Cores/purple_engine_experimental/ChorusCorePhaseWarped.h"
 #include "../Cores/purple_engine_experimental/ChorusCoreOrbit.h"
 #include "../Cores/black_engine_linear/ChorusCoreLinear.h"
 #include "../Cores/black_engine_linear/ChorusCoreLinearEnsemble.h"
+#include <algorithm>
 #include <cmath>
 
 namespace
@@ -60,6 +63,7 @@ std::unique_ptr<ChorusCore> createCoreForId(choroboros::CoreId coreId)
         case choroboros::CoreId::orbit: return std::make_unique<ChorusCoreOrbit>();
         case choroboros::CoreId::linear: return std::make_unique<ChorusCoreLinear>();
         case choroboros::CoreId::ensemble: return std::make_unique<ChorusCoreLinearEnsemble>();
+        case choroboros::CoreId::bbd_approx: return std::make_unique<ChorusCoreBBDApprox>();
         case choroboros::CoreId::count: break;
     }
 
@@ -95,6 +99,10 @@ ChorusDSP::ChorusDSP()
         }
     }
 
+    // Shared tables are built on the registry thread while the host finishes loading us.
+    tableRegistry->prefetch<CoreCrossfadeCurve>(ChorusDSPPrepare::coreCrossfadeCurveKey(),
+                                                &ChorusDSPPrepare::buildCoreCrossfadeCurve);
+
     // Start with Green Normal (Lagrange3rd)
     currentColorIndex = 0;
     currentQualityHQ = false;
@@ -361,9 +369,83 @@ void ChorusDSP::applyRuntimeTuning()
     runtimeTuningApplied = true;
 }
 
+void ChorusDSP::reserveArenaBuffer(juce::AudioBuffer<float>& buffer, int numChannels, int numSamples)
+{
+    ArenaBufferBinding binding;
+    binding.buffer = &buffer;
+    binding.numSamples = numSamples;
+    for (int ch = 0; ch < numChannels; ++ch)
+        binding.channels.push_back(dspArena.reserve(static_cast<size_t>(numSamples)));
+    arenaBufferBindings.push_back(std::move(binding));
+}
+
+void ChorusDSP::bindArenaBuffers()
+{
+    std::vector<float*> channelPointers;
+    for (auto& binding : arenaBufferBindings)
+    {
+        channelPointers.clear();
+        for (const auto& span : binding.channels)
+            channelPointers.push_back(span.data());
+        binding.buffer->setDataToReferTo(channelPointers.data(),
+                                         static_cast<int>(channelPointers.size()),
+                                         binding.numSamples);
+    }
+}
+
+void ChorusDSP::reserveInputHistory()
+{
+    int requiredSamples = 0;
+    const auto require = [&requiredSamples](const std::unique_ptr<ChorusCore>& core)
+    {
+        if (core)
+            requiredSamples = juce::jmax(requiredSamples, core->getSharedHistorySamples());
+    };
+    for (const auto& core : coreVariants)
+        require(core);
+    for (const auto& perEngine : modularCorePool)
+        for (const auto& perMode : perEngine)
+            for (const auto& core : perMode)
+                require(core);
+
+    int historySize = 1;
+    while (historySize < requiredSamples + maxBlockSize)
+        historySize <<= 1;
+    inputHistoryMask = historySize - 1;
+
+    inputHistory.resize(static_cast<size_t>(spec.numChannels));
+    for (auto& channel : inputHistory)
+        channel = dspArena.reserve(static_cast<size_t>(historySize));
+}
+
+void ChorusDSP::writeInputHistory(const juce::dsp::AudioBlock<float>& block)
+{
+    const int numSamples = static_cast<int>(block.getNumSamples());
+    const int numChannels = juce::jmin(static_cast<int>(block.getNumChannels()), static_cast<int>(inputHistory.size()));
+    const int historySize = inputHistoryMask + 1;
+    const int firstPart = juce::jmin(numSamples, historySize - inputHistoryWritePos);
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        const float* source = block.getChannelPointer(static_cast<size_t>(ch));
+        float* ring = inputHistory[static_cast<size_t>(ch)].data();
+        std::copy(source, source + firstPart, ring + inputHistoryWritePos);
+        std::copy(source + firstPart, source + numSamples, ring);
+    }
+
+    inputHistoryBlockStart = inputHistoryWritePos;
+    inputHistoryWritePos = (inputHistoryWritePos + numSamples) & inputHistoryMask;
+}
+
 void ChorusDSP::prepare(const juce::dsp::ProcessSpec& processSpec)
 {
     spec = processSpec;
+    jassert(spec.numChannels <= static_cast<juce::uint32>(kMaxChannels));
+    updateChannelLfoSpread();
+
+    // Every core and buffer reserves its span first; the arena is then allocated in one go.
+    dspArena.beginLayout();
+    arenaBufferBindings.clear();
 
     for (auto& core : coreVariants)
         if (core)
@@ -378,9 +460,9 @@ void ChorusDSP::prepare(const juce::dsp::ProcessSpec& processSpec)
     ChorusDSPPrepare::prepareLFOs(*this, spec);
     ChorusDSPPrepare::prepareBuffers(*this, spec);
     ChorusDSPPrepare::prepareFilters(*this, spec);
-    maxBlockSize = static_cast<int>(spec.maximumBlockSize);
-    coreCrossfadeBufferA.setSize(static_cast<int>(spec.numChannels), maxBlockSize, false, false, true);
-    coreCrossfadeBufferB.setSize(static_cast<int>(spec.numChannels), maxBlockSize, false, false, true);
+    reserveInputHistory();
+    dspArena.commit();
+    bindArenaBuffers();
 
     const size_t channelCount = static_cast<size_t>(juce::jmax(0, static_cast<int>(spec.numChannels)));
     greenWetLPState.assign(channelCount, 0.0f);
@@ -425,6 +507,11 @@ void ChorusDSP::prepare(const juce::dsp::ProcessSpec& processSpec)
 
 void ChorusDSP::reset()
 {
+    for (auto& channel : inputHistory)
+        std::fill(channel.begin(), channel.end(), 0.0f);
+    inputHistoryWritePos = 0;
+    inputHistoryBlockStart = 0;
+
     for (auto& core : coreVariants)
         if (core)
             core->reset();
@@ -717,32 +804,115 @@ void ChorusDSP::processWidth(juce::dsp::AudioBlock<float>& block)
     if (block.getNumChannels() < 2)
         return;
     
-    auto* left = block.getChannelPointer(0);
-    auto* right = block.getChannelPointer(1);
     const int numSamples = static_cast<int>(block.getNumSamples());
     
     // Get smoothed width (block-constant is fine for width)
     float currentWidth = smoothedWidth.getNextValue();
     smoothedWidth.skip(numSamples - 1);
     
-    // Simplified width processing: scale side channel based on width parameter
-    // This avoids the incorrect band-splitting approach that can cause artifacts
-    for (int i = 0; i < numSamples; ++i)
+    // One width stage per channel pair (L/R, Ls/Rs, top pairs, ...)
+    for (int pairIndex = 0; pairIndex < numWidthPairs; ++pairIndex)
     {
-        float l = left[i];
-        float r = right[i];
+        const auto& pair = widthPairs[static_cast<size_t>(pairIndex)];
+        if (pair.right >= static_cast<int>(block.getNumChannels()))
+            continue;
         
-        // M/S conversion
-        float mid = (l + r) * 0.5f;
-        float side = (l - r) * 0.5f;
+        auto* left = block.getChannelPointer(static_cast<size_t>(pair.left));
+        auto* right = block.getChannelPointer(static_cast<size_t>(pair.right));
         
-        // Apply width: scale side channel (0.0 = mono, 2.0 = full width)
-        side *= currentWidth;
-        
-        // Back to L/R
-        left[i] = mid + side;
-        right[i] = mid - side;
+        // Simplified width processing: scale side channel based on width parameter
+        // This avoids the incorrect band-splitting approach that can cause artifacts
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float l = left[i];
+            float r = right[i];
+            
+            // M/S conversion
+            float mid = (l + r) * 0.5f;
+            float side = (l - r) * 0.5f;
+            
+            // Apply width: scale side channel (0.0 = mono, 2.0 = full width)
+            side *= currentWidth;
+            
+            // Back to L/R
+            left[i] = mid + side;
+            right[i] = mid - side;
+        }
+    }
+}
+
+void ChorusDSP::updateChannelLfoSpread()
+{
+    const int numChannels = juce::jmin(kMaxChannels, static_cast<int>(spec.numChannels));
+    channelLfoSpread.fill({});
+    numWidthPairs = 0;
+    
+    // Group = pair or lone channel; groups share out the LFO cycle evenly, channels 0/1 first.
+    std::array<int, kMaxChannels> group;
+    group.fill(-1);
+    int numGroups = 0;
+    const auto addPair = [&](int left, int right)
+    {
+        group[static_cast<size_t>(left)] = numGroups;
+        group[static_cast<size_t>(right)] = numGroups;
+        channelLfoSpread[static_cast<size_t>(left)].partner = right;
+        channelLfoSpread[static_cast<size_t>(right)].partner = left;
+        channelLfoSpread[static_cast<size_t>(right)].followsOffset = true;
+        widthPairs[static_cast<size_t>(numWidthPairs++)] = { left, right };
+        ++numGroups;
+    };
+    
+    if (numChannels >= 2)
+        addPair(0, 1);
+    for (const auto& pair : channelPairs)
+    {
+        const bool valid = pair.left >= 0 && pair.right >= 0 && pair.left != pair.right
+                        && pair.left < numChannels && pair.right < numChannels
+                        && group[static_cast<size_t>(pair.left)] < 0 && group[static_cast<size_t>(pair.right)] < 0;
+        if (valid)
+            addPair(pair.left, pair.right);
+    }
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        if (group[static_cast<size_t>(ch)] >= 0)
+            continue;
+        group[static_cast<size_t>(ch)] = numGroups++;
+        channelLfoSpread[static_cast<size_t>(ch)].partner = ch;
+    }
+    
+    for (int ch = 0; ch < numChannels; ++ch)
+        channelLfoSpread[static_cast<size_t>(ch)].phaseRad = juce::MathConstants<float>::twoPi
+            * static_cast<float>(group[static_cast<size_t>(ch)]) / static_cast<float>(juce::jmax(1, numGroups));
+}
+
+std::vector<ChorusDSP::ChannelPair> ChorusDSP::channelPairsForLayout(const juce::AudioChannelSet& layout)
+{
+    using Set = juce::AudioChannelSet;
+    static constexpr std::array<std::pair<Set::ChannelType, Set::ChannelType>, 8> pairTypes {{
+        { Set::left, Set::right },
+        { Set::leftSurround, Set::rightSurround },
+        { Set::leftSurroundSide, Set::rightSurroundSide },
+        { Set::leftSurroundRear, Set::rightSurroundRear },
+        { Set::wideLeft, Set::wideRight },
+        { Set::topFrontLeft, Set::topFrontRight },
+        { Set::topSideLeft, Set::topSideRight },
+        { Set::topRearLeft, Set::topRearRight },
+    }};
+    
+    std::vector<ChannelPair> pairs;
+    for (const auto& types : pairTypes)
+    {
+        const int left = layout.getChannelIndexForType(types.first);
+        const int right = layout.getChannelIndexForType(types.second);
+        if (left >= 0 && right >= 0)
+            pairs.push_back({ left, right });
     }
+    
+    // Discrete layouts carry no speaker roles: pair neighbouring channels.
+    if (pairs.empty() && layout.isDiscreteLayout())
+        for (int ch = 0; ch + 1 < layout.size(); ch += 2)
+            pairs.push_back({ ch, ch + 1 });
+    return pairs;
 }
 
 void ChorusDSP::process(const juce::dsp::AudioBlock<float>& block)
@@ -913,8 +1083,9 @@ void ChorusDSP::switchCore(int colorIndex, bool hq)
         switchSeverity = juce::jmax(switchSeverity, 0.40f);
     switchSeverity = juce::jlimit(0.0f, 1.0f, switchSeverity);
 
-    // Warm up the target core silently before audible crossfade to avoid residual-state zippering
-    // when revisiting a previously used engine.
+    // Cores with a private delay line warm up silently before the audible crossfade to avoid
+    // residual-state zippering when revisiting a previously used engine. Cores reading the shared
+    // input history already have valid memory and go straight to the crossfade.
     coreSwitchOldParamsSnapshotValid = true;
     coreSwitchOldRateHz = smoothedRate.getCurrentValue();
     coreSwitchOldDepth = smoothedDepthValue;
@@ -930,7 +1101,9 @@ void ChorusDSP::switchCore(int colorIndex, bool hq)
     {
         const float warmupMs = juce::jmap(switchSeverity, 22.0f, 95.0f);
         const float crossfadeMs = juce::jmap(switchSeverity, 45.0f, 170.0f);
-        coreSwitchWarmupTotalSamples = juce::jmax(1, static_cast<int>(std::round(spec.sampleRate * warmupMs * 0.001f)));
+        coreSwitchWarmupTotalSamples = newCore->readsSharedHistory()
+            ? 0
+            : juce::jmax(1, static_cast<int>(std::round(spec.sampleRate * warmupMs * 0.001f)));
         coreSwitchTargetCrossfadeSamples = juce::jmax(1, static_cast<int>(std::round(spec.sampleRate * crossfadeMs * 0.001f)));
         coreSwitchWarmupSamplesRemaining = coreSwitchWarmupTotalSamples;
     }
@@ -959,6 +1132,28 @@ void ChorusDSP::setModularCoreModeEnabled(bool enabled)
     switchCore(currentColorIndex, currentQualityHQ);
 }
 
+void ChorusDSP::setNonRealtime(bool isNonRealtime)
+{
+    nonRealtimeRendering = isNonRealtime;
+
+    // Keep the pool once acquired so bounce/playback toggles do not churn worker threads.
+    if (isNonRealtime && channelWorkerPool == nullptr)
+        channelWorkerPool = std::make_unique<juce::SharedResourcePointer<choroboros::ChannelWorkerPool>>();
+}
+
+void ChorusDSP::setQualityGovernorLevel(int level)
+{
+    using Level = choroboros::QualityGovernor::Level;
+    reducedHqInterpolation = level >= static_cast<int>(Level::reducedInterpolation);
+    lfoControlInterval = level >= static_cast<int>(Level::coarseControlRate) ? kCoarseLfoControlInterval : 1;
+}
+
+void ChorusDSP::setWetTap(WetTapCallback callback, void* context)
+{
+    wetTapCallback = callback;
+    wetTapContext = context;
+}
+
 void ChorusDSP::setCoreAssignments(const choroboros::CoreAssignmentTable& assignments)
 {
     coreAssignments = assignments;
@@ -21,6 +21,10 @@
 #include <juce_dsp/juce_dsp.h>
 #include <juce_audio_basics/juce_audio_basics.h>
 #include "CoreAssignments.h"
+#include "ChannelWorkerPool.h"
+#include "BlockRamp.h"
+#include "DspArena.h"
+#include "DspTableRegistry.h"
 #include <atomic>
 #include <array>
 #include <memory>
@@ -172,6 +176,36 @@ public:
     void setQualityEnabled(bool enabled); // false=Normal, true=HQ
     void setMix(float mix); // 0.0 to 1.0 (dry/wet mix)
     void setModularCoreModeEnabled(bool enabled);
+    // Offline renders may fan per-channel core work out to the shared channel worker pool.
+    void setNonRealtime(bool isNonRealtime);
+    bool isNonRealtime() const { return nonRealtimeRendering; }
+    
+    // Applies a QualityGovernor level (0 = full quality). Audio thread only.
+    void setQualityGovernorLevel(int level);
+    bool isHqInterpolationReduced() const { return reducedHqInterpolation; }
+    // True while a requested core is still warming up or waiting for a crossfade to finish.
+    bool isCoreSwitchPending() const { return pendingCore != nullptr; }
+    
+    // Surround and immersive beds. Channels 0/1 always form the first pair; every further pair
+    // gets its own LFO base phase (its right member adds the offset, as R does) and its own
+    // width stage, and unpaired channels (C, LFE, ...) are spread evenly between them.
+    // Message thread only; takes effect at the next prepare().
+    static constexpr int kMaxChannels = 16;
+    struct ChannelPair
+    {
+        int left = 0;
+        int right = 1;
+    };
+    void setChannelPairs(const std::vector<ChannelPair>& pairs) { channelPairs = pairs; }
+    static std::vector<ChannelPair> channelPairsForLayout(const juce::AudioChannelSet& layout);
+    int getNumWidthPairs() const { return numWidthPairs; }
+    float getChannelLfoPhaseRad(int channel) const { return channelLfoSpread[static_cast<size_t>(channel)].phaseRad; }
+    
+    // Wet tap: called on the audio thread with the final wet block just before dry/wet mixing.
+    // right is nullptr for mono blocks. The callback must be realtime-safe.
+    using WetTapCallback = void (*)(void* context, const float* left, const float* right, int numSamples);
+    void setWetTap(WetTapCallback callback, void* context);
+    void setWetTapEnabled(bool enabled) { wetTapEnabled = enabled; }
     bool isModularCoreModeEnabled() const { return modularCoreModeEnabled; }
     void setCoreAssignments(const choroboros::CoreAssignmentTable& assignments);
     const choroboros::CoreAssignmentTable& getCoreAssignments() const { return coreAssignments; }
@@ -184,8 +218,32 @@ public:
     static const std::array<choroboros::CorePackageDescriptor, choroboros::coreIdCount()>& getCorePackageDescriptors();
     static const choroboros::CorePackageDescriptor& getCorePackageDescriptor(choroboros::CoreId coreId);
 
+    // Per-channel modulation for cores: 0 = lfoBuffer, 1 = cosBuffer, 2+ = phase-spread LFOs.
+    // The partner is the other half of the channel's pair (itself when unpaired).
+    const float* getChannelLfo(int channel) const noexcept
+    {
+        if (channel == 0)
+            return lfoBuffer.getReadPointer(0);
+        if (channel == 1)
+            return cosBuffer.getReadPointer(0);
+        return lfoSpreadBuffer.getReadPointer(channel - 2);
+    }
+    const float* getChannelPartnerLfo(int channel) const noexcept
+    {
+        return getChannelLfo(channelLfoSpread[static_cast<size_t>(channel)].partner);
+    }
+
     RuntimeTuning& getRuntimeTuning() { return runtimeTuning; }
     const RuntimeTuning& getRuntimeTuning() const { return runtimeTuning; }
+
+    // Core delay lines, BBD stages, LFO and crossfade buffers live in one arena, laid out and
+    // allocated once per prepare(). Cores reserve their spans from it in ChorusCore::prepare().
+    choroboros::DspArena& getDspArena() noexcept { return dspArena; }
+    size_t getArenaFootprintBytes() const noexcept { return dspArena.getFootprintBytes(); }
+    bool isArenaHugePageBacked() const noexcept { return dspArena.isHugePageBacked(); }
+
+    // Immutable lookup tables shared with every other instance in the process.
+    choroboros::DspTableRegistry& getTableRegistry() noexcept { return *tableRegistry; }
     
     // Make members accessible to helper classes and cores
     friend class ChorusDSPPrepare;
@@ -196,6 +254,7 @@ public:
     friend class ChorusCoreCubic;
     friend class ChorusCoreThiran;
     friend class ChorusCoreBBD;
+    friend class ChorusCoreBBDApprox;
     friend class ChorusCoreTape;
     friend class ChorusCorePhaseWarped;
     friend class ChorusCoreOrbit;
@@ -363,6 +422,43 @@ private:
     float lastBaseLfoPhaseRad = 0.0f;
     float lastLfoAmplitude = 0.0f;
     
+    // Channel-parallel core rendering for large offline blocks (see ChorusDSPProcess::processCoreDelay).
+    // The pool is shared process-wide and only acquired once a host first renders offline.
+    static constexpr int kChannelParallelMinBlockSamples = 1024;
+    bool nonRealtimeRendering = false;
+    std::unique_ptr<juce::SharedResourcePointer<choroboros::ChannelWorkerPool>> channelWorkerPool;
+    
+    // Realtime quality reductions driven by the processor's QualityGovernor.
+    static constexpr int kCoarseLfoControlInterval = 16;
+    bool reducedHqInterpolation = false;  // Green/Blue HQ read with their NQ interpolator
+    int lfoControlInterval = 1;           // Samples between LFO offset rotation updates
+    
+    WetTapCallback wetTapCallback = nullptr;
+    void* wetTapContext = nullptr;
+    bool wetTapEnabled = false;
+
+    juce::SharedResourcePointer<choroboros::DspTableRegistry> tableRegistry;
+    choroboros::DspArena dspArena;
+    // AudioBuffers that refer to arena memory; re-pointed after every commit.
+    struct ArenaBufferBinding
+    {
+        juce::AudioBuffer<float>* buffer = nullptr;
+        std::vector<choroboros::ArenaSpan> channels;
+        int numSamples = 0;
+    };
+    std::vector<ArenaBufferBinding> arenaBufferBindings;
+    void reserveArenaBuffer(juce::AudioBuffer<float>& buffer, int numChannels, int numSamples);
+    void bindArenaBuffers();
+
+    // Dry input ring read by every core that reports getSharedHistorySamples() > 0. Written once
+    // per block before any core runs; inputHistoryBlockStart is the block's first sample.
+    std::vector<choroboros::ArenaSpan> inputHistory;
+    int inputHistoryMask = 0;
+    int inputHistoryWritePos = 0;
+    int inputHistoryBlockStart = 0;
+    void reserveInputHistory();
+    void writeInputHistory(const juce::dsp::AudioBlock<float>& block);
+    
     // Create and switch to a new core based on color and quality
     void switchCore(int colorIndex, bool hq);
     ChorusCore* resolveCorePointer(int colorIndex, bool hqEnabled, choroboros::CoreId* outCoreId);
@@ -380,11 +476,22 @@ private:
     // Pre-allocated buffers (CRITICAL: no heap allocation in process())
     juce::AudioBuffer<float> lfoBuffer;  // LFO buffer
     juce::AudioBuffer<float> cosBuffer;  // Cosine buffer for stereo
+    juce::AudioBuffer<float> lfoSpreadBuffer;  // Channels 2+ of surround beds (absent for mono/stereo)
     juce::AudioBuffer<float> delaySamplesBuffer;  // Delay samples buffer
     juce::AudioBuffer<float> preEmphOriginalBuffer;  // Original signal storage for pre-emphasis
     juce::AudioBuffer<float> coreCrossfadeBufferA;  // Wet path buffer for active core
     juce::AudioBuffer<float> coreCrossfadeBufferB;  // Wet path buffer for previous core
     
+    // Core-switch gains (shaped equal-power pair with edge and mid ducks folded in) sampled
+    // over crossfade progress; read with linear interpolation instead of pow/sin/cos per sample.
+    struct CoreCrossfadeCurve
+    {
+        static constexpr int kPoints = 1024;
+        std::array<float, kPoints + 1> newGain {};
+        std::array<float, kPoints + 1> oldGain {};
+    };
+    std::shared_ptr<const CoreCrossfadeCurve> coreCrossfadeCurve;
+    
     // Additional processing stages
     juce::dsp::IIR::Filter<float> hpf;  // High pass filter
     juce::dsp::IIR::Coefficients<float>::Ptr hpfCoeffs;
@@ -422,7 +529,7 @@ private:
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothedCentreDelay;  // Centre delay smoothing
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothedColor;  // Color smoothing
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothedWidth;  // Width smoothing
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothedOffset;  // Offset smoothing
+    choroboros::LinearBlockRamp smoothedOffset;  // Offset smoothing (filled per block)
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothedMix;  // Mix smoothing
     
     // Target parameters
@@ -438,6 +545,18 @@ private:
     void processGreenBloomWet(juce::dsp::AudioBlock<float>& block, float colorValue);
     void processBlueFocusWet(juce::dsp::AudioBlock<float>& block, float colorValue);
     void processWidth(juce::dsp::AudioBlock<float>& block);  // Width processing
+    void updateChannelLfoSpread();
+
+    struct ChannelLfoSpread
+    {
+        float phaseRad = 0.0f;       // Base phase relative to channel 0
+        bool followsOffset = false;  // Right member of a pair: adds the offset parameter
+        int partner = 0;
+    };
+    std::vector<ChannelPair> channelPairs;  // As configured; validated in updateChannelLfoSpread()
+    std::array<ChannelLfoSpread, kMaxChannels> channelLfoSpread {};
+    std::array<ChannelPair, kMaxChannels / 2> widthPairs {};
+    int numWidthPairs = 0;
     float calculateCentreDelay(float depthValue);  // Centre delay calculation
     
     // Engine-specific parameter mapping
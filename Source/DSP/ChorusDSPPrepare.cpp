@@ -71,12 +71,55 @@ void ChorusDSPPrepare::prepareFilters(ChorusDSP& chorusDSP, const juce::dsp::Pro
 void ChorusDSPPrepare::prepareBuffers(ChorusDSP& chorusDSP, const juce::dsp::ProcessSpec& spec)
 {
     chorusDSP.maxBlockSize = static_cast<int>(spec.maximumBlockSize);
-    chorusDSP.lfoBuffer.setSize(1, chorusDSP.maxBlockSize);
-    chorusDSP.cosBuffer.setSize(1, chorusDSP.maxBlockSize);
-    chorusDSP.delaySamplesBuffer.setSize(1, chorusDSP.maxBlockSize);
-    chorusDSP.preEmphOriginalBuffer.setSize(spec.numChannels, chorusDSP.maxBlockSize);
+    const int numChannels = static_cast<int>(spec.numChannels);
+    chorusDSP.reserveArenaBuffer(chorusDSP.lfoBuffer, 1, chorusDSP.maxBlockSize);
+    chorusDSP.reserveArenaBuffer(chorusDSP.cosBuffer, 1, chorusDSP.maxBlockSize);
+    if (numChannels > 2)
+        chorusDSP.reserveArenaBuffer(chorusDSP.lfoSpreadBuffer, numChannels - 2, chorusDSP.maxBlockSize);
+    else
+        chorusDSP.lfoSpreadBuffer.setSize(0, 0);
+    chorusDSP.reserveArenaBuffer(chorusDSP.delaySamplesBuffer, 1, chorusDSP.maxBlockSize);
+    chorusDSP.reserveArenaBuffer(chorusDSP.preEmphOriginalBuffer, numChannels, chorusDSP.maxBlockSize);
+    chorusDSP.reserveArenaBuffer(chorusDSP.coreCrossfadeBufferA, numChannels, chorusDSP.maxBlockSize);
+    chorusDSP.reserveArenaBuffer(chorusDSP.coreCrossfadeBufferB, numChannels, chorusDSP.maxBlockSize);
+    if (chorusDSP.coreCrossfadeCurve == nullptr)
+        chorusDSP.coreCrossfadeCurve = chorusDSP.getTableRegistry().acquire<ChorusDSP::CoreCrossfadeCurve>(
+            coreCrossfadeCurveKey(), &buildCoreCrossfadeCurve);
     
     chorusDSP.dryWet.setMixingRule(juce::dsp::DryWetMixingRule::linear);
     chorusDSP.dryWet.prepare(spec);
     chorusDSP.dryWet.setWetMixProportion(0.5f);
 }
+
+choroboros::DspTableRegistry::Key ChorusDSPPrepare::coreCrossfadeCurveKey() noexcept
+{
+    return { choroboros::DspTableRegistry::TableKind::coreCrossfadeCurve, 0.0, ChorusDSP::CoreCrossfadeCurve::kPoints, 0 };
+}
+
+std::unique_ptr<ChorusDSP::CoreCrossfadeCurve> ChorusDSPPrepare::buildCoreCrossfadeCurve(const choroboros::DspTableRegistry::Key&)
+{
+    auto curve = std::make_unique<ChorusDSP::CoreCrossfadeCurve>();
+    constexpr int points = ChorusDSP::CoreCrossfadeCurve::kPoints;
+    for (int i = 0; i <= points; ++i)
+    {
+        const float progress = static_cast<float>(i) / static_cast<float>(points);
+        // Bias the transition toward the old core during early samples so stale-state transients
+        // in the new core stay masked while its delay memory settles.
+        constexpr float crossfadeCurveExp = 1.8f;
+        const float shapedProgress = std::pow(progress, crossfadeCurveExp);
+        const float newGain = std::sin(shapedProgress * juce::MathConstants<float>::halfPi);
+        const float oldGain = std::cos(shapedProgress * juce::MathConstants<float>::halfPi);
+        // Extra edge de-click treatment: short attenuation at transition start/end
+        // suppresses single-sample discontinuities when switching core states.
+        constexpr float edgeWindow = 0.08f; // 8% of crossfade length
+        const float edgeIn = juce::jlimit(0.0f, 1.0f, progress / edgeWindow);
+        const float edgeOut = juce::jlimit(0.0f, 1.0f, (1.0f - progress) / edgeWindow);
+        const float edgeBlend = juce::jmin(edgeIn, edgeOut);
+        const float edgeDuckGain = 0.82f + 0.18f * edgeBlend;
+        const float midDuckGain = 1.0f - 0.08f * std::sin(progress * juce::MathConstants<float>::pi);
+        const float duckGain = edgeDuckGain * midDuckGain;
+        curve->newGain[static_cast<size_t>(i)] = newGain * duckGain;
+        curve->oldGain[static_cast<size_t>(i)] = oldGain * duckGain;
+    }
+    return curve;
+}
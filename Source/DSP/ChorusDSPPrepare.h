@@ -28,4 +28,7 @@ public:
     static void prepareLFOs(ChorusDSP& chorusDSP, const juce::dsp::ProcessSpec& spec);
     static void prepareFilters(ChorusDSP& chorusDSP, const juce::dsp::ProcessSpec& spec);
     static void prepareBuffers(ChorusDSP& chorusDSP, const juce::dsp::ProcessSpec& spec);
+    
+    static std::unique_ptr<ChorusDSP::CoreCrossfadeCurve> buildCoreCrossfadeCurve(const choroboros::DspTableRegistry::Key& key);
+    static choroboros::DspTableRegistry::Key coreCrossfadeCurveKey() noexcept;
 };
@@ -19,6 +19,7 @@
 #include "ChorusDSPProcess.h"
 #include "ChorusDSP.h"
 #include "../Cores/ChorusCore.h"
+#include <array>
 #include <cmath>
 
 void ChorusDSPProcess::processPreEmphasis(ChorusDSP& chorusDSP, juce::dsp::AudioBlock<float>& block)
@@ -238,17 +239,57 @@ void ChorusDSPProcess::processChorusLFO(ChorusDSP& chorusDSP, int blockNumSample
         auto* lfoLeft = chorusDSP.lfoBuffer.getWritePointer(0);
         auto* cosSamples = chorusDSP.cosBuffer.getWritePointer(0);
         
-        for (int i = 0; i < blockNumSamples; ++i)
+        // Under CPU pressure the governor coarsens the control rate: the smoother still advances
+        // every sample, but the offset rotation is only re-evaluated every controlInterval samples.
+        const int controlInterval = juce::jmax(1, chorusDSP.lfoControlInterval);
+        if (!chorusDSP.smoothedOffset.isSmoothing())
         {
-            // Consume offset smoother per-sample so phase offset transitions are truly continuous,
-            // eliminating residual block-step zippering on sensitive engines (e.g. Black NQ).
-            const float phaseOffsetDeg = chorusDSP.smoothedOffset.getNextValue();
+            // Settled offset: one rotation for the whole block.
+            const float phaseOffsetDeg = chorusDSP.smoothedOffset.getTargetValue();
             const float phaseOffsetRad = phaseOffsetDeg * juce::MathConstants<float>::pi / 180.0f;
             const float cosOffset = std::cos(phaseOffsetRad);
             const float sinOffset = std::sin(phaseOffsetRad);
-            cosSamples[i] = lfoLeft[i] * cosOffset + cosSamples[i] * sinOffset;
+            if (numChannels > 2)
+                processSpreadLFOs(chorusDSP, numChannels, 0, blockNumSamples, &cosOffset, &sinOffset, false);
+            for (int i = 0; i < blockNumSamples; ++i)
+                cosSamples[i] = lfoLeft[i] * cosOffset + cosSamples[i] * sinOffset;
             chorusDSP.lfoPhaseOffset = phaseOffsetDeg;
         }
+        else
+        {
+            // Offset ramps are filled per chunk so phase offset transitions are truly continuous,
+            // eliminating residual block-step zippering on sensitive engines (e.g. Black NQ).
+            std::array<float, choroboros::kBlockRampChunkSamples> offsetsDeg;
+            std::array<float, choroboros::kBlockRampChunkSamples> offsetCos;
+            std::array<float, choroboros::kBlockRampChunkSamples> offsetSin;
+            float cosOffset = 0.0f;
+            float sinOffset = 1.0f;
+            for (int start = 0; start < blockNumSamples; start += choroboros::kBlockRampChunkSamples)
+            {
+                const int chunk = juce::jmin(choroboros::kBlockRampChunkSamples, blockNumSamples - start);
+                chorusDSP.smoothedOffset.fill(offsetsDeg.data(), chunk);
+                for (int j = 0; j < chunk; ++j)
+                {
+                    if ((start + j) % controlInterval == 0)
+                    {
+                        const float phaseOffsetRad = offsetsDeg[static_cast<size_t>(j)] * juce::MathConstants<float>::pi / 180.0f;
+                        cosOffset = std::cos(phaseOffsetRad);
+                        sinOffset = std::sin(phaseOffsetRad);
+                    }
+                    offsetCos[static_cast<size_t>(j)] = cosOffset;
+                    offsetSin[static_cast<size_t>(j)] = sinOffset;
+                }
+                // Surround channels read the unrotated cosine, so they go before R is rotated in place.
+                if (numChannels > 2)
+                    processSpreadLFOs(chorusDSP, numChannels, start, chunk, offsetCos.data(), offsetSin.data(), true);
+                for (int j = 0; j < chunk; ++j)
+                {
+                    const int i = start + j;
+                    cosSamples[i] = lfoLeft[i] * offsetCos[static_cast<size_t>(j)] + cosSamples[i] * offsetSin[static_cast<size_t>(j)];
+                }
+                chorusDSP.lfoPhaseOffset = offsetsDeg[static_cast<size_t>(chunk - 1)];
+            }
+        }
     }
     else if (blockNumSamples > 0)
     {
@@ -263,11 +304,76 @@ void ChorusDSPProcess::processChorusLFO(ChorusDSP& chorusDSP, int blockNumSample
     }
 }
 
+void ChorusDSPProcess::processSpreadLFOs(ChorusDSP& chorusDSP, int numChannels, int startSample, int numSamples,
+                                         const float* offsetCos, const float* offsetSin, bool perSampleOffset)
+{
+    // Channels 2+ are rotations of the unrotated sine/cosine pair: sin(phase + spread [+ offset]).
+    // The offset is composed onto the spread by angle addition, sample by sample like R's.
+    const float* sinSamples = chorusDSP.lfoBuffer.getReadPointer(0, startSample);
+    const float* cosSamples = chorusDSP.cosBuffer.getReadPointer(0, startSample);
+    for (int ch = 2; ch < numChannels; ++ch)
+    {
+        const auto& spread = chorusDSP.channelLfoSpread[static_cast<size_t>(ch)];
+        const float cosSpread = std::cos(spread.phaseRad);
+        const float sinSpread = std::sin(spread.phaseRad);
+        auto* out = chorusDSP.lfoSpreadBuffer.getWritePointer(ch - 2, startSample);
+        if (!spread.followsOffset || !perSampleOffset)
+        {
+            const float cosPhase = spread.followsOffset ? cosSpread * offsetCos[0] - sinSpread * offsetSin[0] : cosSpread;
+            const float sinPhase = spread.followsOffset ? sinSpread * offsetCos[0] + cosSpread * offsetSin[0] : sinSpread;
+            for (int i = 0; i < numSamples; ++i)
+                out[i] = sinSamples[i] * cosPhase + cosSamples[i] * sinPhase;
+            continue;
+        }
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float cosPhase = cosSpread * offsetCos[i] - sinSpread * offsetSin[i];
+            const float sinPhase = sinSpread * offsetCos[i] + cosSpread * offsetSin[i];
+            out[i] = sinSamples[i] * cosPhase + cosSamples[i] * sinPhase;
+        }
+    }
+}
+
 void ChorusDSPProcess::processChorusDelay(ChorusDSP& chorusDSP, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
 {
     // Delegate to the current core
     if (chorusDSP.currentCore)
-        chorusDSP.currentCore->processDelay(chorusDSP, block, currentCentreDelayMs);
+        processCoreDelay(chorusDSP, *chorusDSP.currentCore, block, currentCentreDelayMs);
+}
+
+void ChorusDSPProcess::processCoreDelay(ChorusDSP& chorusDSP, ChorusCore& core, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs)
+{
+    const int numChannels = static_cast<int>(block.getNumChannels());
+    const bool fanOutChannels = chorusDSP.nonRealtimeRendering
+                                && chorusDSP.channelWorkerPool != nullptr
+                                && numChannels > 1
+                                && static_cast<int>(block.getNumSamples()) >= ChorusDSP::kChannelParallelMinBlockSamples
+                                && core.supportsChannelParallelism();
+    if (!fanOutChannels)
+    {
+        core.processDelay(chorusDSP, block, currentCentreDelayMs);
+        return;
+    }
+
+    // Offline only: LFO buffers are already filled, so channels are independent once the
+    // core's shared per-block state is advanced. run() joins before we return, so wet
+    // character and mix always see the complete block.
+    core.beginDelayBlock(chorusDSP, block, currentCentreDelayMs);
+
+    struct ChannelJob
+    {
+        ChorusDSP* dsp;
+        ChorusCore* core;
+        juce::dsp::AudioBlock<float>* block;
+        float centreDelayMs;
+    } job { &chorusDSP, &core, &block, currentCentreDelayMs };
+
+    chorusDSP.channelWorkerPool->get().run([](void* context, int channel)
+    {
+        auto& channelJob = *static_cast<ChannelJob*>(context);
+        channelJob.core->processDelayChannel(*channelJob.dsp, *channelJob.block, channelJob.centreDelayMs, channel);
+    }, &job, numChannels);
 }
 
 void ChorusDSPProcess::processChorus(ChorusDSP& chorusDSP, juce::dsp::AudioBlock<float>& block)
@@ -282,9 +388,15 @@ void ChorusDSPProcess::processChorus(ChorusDSP& chorusDSP, juce::dsp::AudioBlock
     processChorusLFO(chorusDSP, blockNumSamples, numChannels, currentRate, currentDepth);
     
     chorusDSP.dryWet.pushDrySamples(block);
+    chorusDSP.writeInputHistory(block);
 
     bool pendingCoreReady = false;
-    if (chorusDSP.pendingCore != nullptr)
+    if (chorusDSP.pendingCore != nullptr && chorusDSP.pendingCore->readsSharedHistory())
+    {
+        // Nothing to warm up: the shared history already holds everything the core will read.
+        pendingCoreReady = true;
+    }
+    else if (chorusDSP.pendingCore != nullptr)
     {
         jassert(blockNumSamples <= chorusDSP.maxBlockSize);
         jassert(numChannels <= static_cast<int>(chorusDSP.coreCrossfadeBufferA.getNumChannels()));
@@ -298,7 +410,7 @@ void ChorusDSPProcess::processChorus(ChorusDSP& chorusDSP, juce::dsp::AudioBlock
         auto wetPending = juce::dsp::AudioBlock<float>(chorusDSP.coreCrossfadeBufferA.getArrayOfWritePointers(),
                                                        static_cast<size_t>(numChannels),
                                                        static_cast<size_t>(blockNumSamples));
-        chorusDSP.pendingCore->processDelay(chorusDSP, wetPending, currentCentreDelayMs);
+        processCoreDelay(chorusDSP, *chorusDSP.pendingCore, wetPending, currentCentreDelayMs);
 
         if (chorusDSP.coreSwitchWarmupSamplesRemaining > 0)
             chorusDSP.coreSwitchWarmupSamplesRemaining = juce::jmax(0, chorusDSP.coreSwitchWarmupSamplesRemaining - blockNumSamples);
@@ -327,7 +439,7 @@ void ChorusDSPProcess::processChorus(ChorusDSP& chorusDSP, juce::dsp::AudioBlock
                                                         static_cast<size_t>(blockNumSamples));
 
         if (chorusDSP.currentCore != nullptr)
-            chorusDSP.currentCore->processDelay(chorusDSP, wetCurrent, currentCentreDelayMs);
+            processCoreDelay(chorusDSP, *chorusDSP.currentCore, wetCurrent, currentCentreDelayMs);
 
         if (chorusDSP.coreSwitchOldParamsSnapshotValid)
         {
@@ -340,6 +452,7 @@ void ChorusDSPProcess::processChorus(ChorusDSP& chorusDSP, juce::dsp::AudioBlock
             const float amp = chorusDSP.coreSwitchOldLfoAmplitude;
             const float oldOffsetRad = chorusDSP.coreSwitchOldOffsetDegrees
                                        * juce::MathConstants<float>::pi / 180.0f;
+            const float startPhase = phase;
             for (int i = 0; i < blockNumSamples; ++i)
             {
                 phase += phaseInc;
@@ -353,6 +466,19 @@ void ChorusDSPProcess::processChorus(ChorusDSP& chorusDSP, juce::dsp::AudioBlock
             }
             chorusDSP.coreSwitchOldBasePhaseRad = phase;
 
+            // Surround channels: same walk, shifted by each channel's spread phase.
+            for (int ch = 2; ch < numChannels; ++ch)
+            {
+                const auto& spread = chorusDSP.channelLfoSpread[static_cast<size_t>(ch)];
+                float channelPhase = startPhase + spread.phaseRad + (spread.followsOffset ? oldOffsetRad : 0.0f);
+                auto* oldSpread = chorusDSP.lfoSpreadBuffer.getWritePointer(ch - 2);
+                for (int i = 0; i < blockNumSamples; ++i)
+                {
+                    channelPhase += phaseInc;
+                    oldSpread[i] = amp * std::sin(channelPhase);
+                }
+            }
+
             const float savedRateCurrent = chorusDSP.smoothedRate.getCurrentValue();
             const float savedRateTarget = chorusDSP.smoothedRate.getTargetValue();
             const float savedColorCurrent = chorusDSP.smoothedColor.getCurrentValue();
@@ -363,7 +489,7 @@ void ChorusDSPProcess::processChorus(ChorusDSP& chorusDSP, juce::dsp::AudioBlock
             chorusDSP.smoothedColor.setCurrentAndTargetValue(chorusDSP.coreSwitchOldColor);
             chorusDSP.colorBlockValue = chorusDSP.coreSwitchOldColor;
 
-            chorusDSP.previousCore->processDelay(chorusDSP, wetPrevious, chorusDSP.coreSwitchOldCentreDelayMs);
+            processCoreDelay(chorusDSP, *chorusDSP.previousCore, wetPrevious, chorusDSP.coreSwitchOldCentreDelayMs);
 
             chorusDSP.smoothedRate.setCurrentAndTargetValue(savedRateCurrent);
             chorusDSP.smoothedRate.setTargetValue(savedRateTarget);
@@ -373,35 +499,30 @@ void ChorusDSPProcess::processChorus(ChorusDSP& chorusDSP, juce::dsp::AudioBlock
         }
         else
         {
-            chorusDSP.previousCore->processDelay(chorusDSP, wetPrevious, currentCentreDelayMs);
+            processCoreDelay(chorusDSP, *chorusDSP.previousCore, wetPrevious, currentCentreDelayMs);
         }
 
         const int totalSamples = juce::jmax(1, chorusDSP.coreSwitchCrossfadeTotalSamples);
         int remaining = chorusDSP.coreSwitchCrossfadeSamplesRemaining;
 
+        // Shared gain curve (see ChorusDSPPrepare::buildCoreCrossfadeCurve), ducks already applied.
+        const auto& curve = *chorusDSP.coreCrossfadeCurve;
+        constexpr float curvePoints = static_cast<float>(ChorusDSP::CoreCrossfadeCurve::kPoints);
+
         for (int i = 0; i < blockNumSamples; ++i)
         {
             const float progress = 1.0f - (static_cast<float>(juce::jmax(remaining, 0)) / static_cast<float>(totalSamples));
-            // Bias the transition toward the old core during early samples so stale-state transients
-            // in the new core stay masked while its delay memory settles.
-            constexpr float crossfadeCurveExp = 1.8f;
-            const float shapedProgress = std::pow(progress, crossfadeCurveExp);
-            const float newGain = std::sin(shapedProgress * juce::MathConstants<float>::halfPi);
-            const float oldGain = std::cos(shapedProgress * juce::MathConstants<float>::halfPi);
-            // Extra edge de-click treatment: short attenuation at transition start/end
-            // suppresses single-sample discontinuities when switching core states.
-            constexpr float edgeWindow = 0.08f; // 8% of crossfade length
-            const float edgeIn = juce::jlimit(0.0f, 1.0f, progress / edgeWindow);
-            const float edgeOut = juce::jlimit(0.0f, 1.0f, (1.0f - progress) / edgeWindow);
-            const float edgeBlend = juce::jmin(edgeIn, edgeOut);
-            const float edgeDuckGain = 0.82f + 0.18f * edgeBlend;
-            const float midDuckGain = 1.0f - 0.08f * std::sin(progress * juce::MathConstants<float>::pi);
-            const float duckGain = edgeDuckGain * midDuckGain;
+            const float position = progress * curvePoints;
+            const int index = juce::jmin(static_cast<int>(position), ChorusDSP::CoreCrossfadeCurve::kPoints - 1);
+            const float frac = position - static_cast<float>(index);
+            const auto idx = static_cast<size_t>(index);
+            const float newGain = curve.newGain[idx] + frac * (curve.newGain[idx + 1] - curve.newGain[idx]);
+            const float oldGain = curve.oldGain[idx] + frac * (curve.oldGain[idx + 1] - curve.oldGain[idx]);
             for (int ch = 0; ch < numChannels; ++ch)
             {
                 const float wetNew = chorusDSP.coreCrossfadeBufferA.getSample(ch, i);
                 const float wetOld = chorusDSP.coreCrossfadeBufferB.getSample(ch, i);
-                block.setSample(ch, i, (wetOld * oldGain + wetNew * newGain) * duckGain);
+                block.setSample(ch, i, wetOld * oldGain + wetNew * newGain);
             }
             remaining = juce::jmax(remaining - 1, 0);
         }
@@ -430,6 +551,8 @@ void ChorusDSPProcess::processChorus(ChorusDSP& chorusDSP, juce::dsp::AudioBlock
         chorusDSP.pendingCore = nullptr;
         chorusDSP.coreSwitchWarmupSamplesRemaining = 0;
         chorusDSP.coreSwitchWarmupTotalSamples = 0;
+        if (chorusDSP.currentCore->readsSharedHistory())
+            chorusDSP.currentCore->resumeFromSharedHistory();
 
         if (chorusDSP.previousCore != nullptr && chorusDSP.spec.sampleRate > 0.0)
         {
@@ -452,5 +575,13 @@ void ChorusDSPProcess::processChorus(ChorusDSP& chorusDSP, juce::dsp::AudioBlock
     // Apply wet-character (Green/Blue) and Red NQ saturation before dry/wet mix.
     processWetCharacter(chorusDSP, block);
     processPostChorusSaturation(chorusDSP, block);
+
+    if (chorusDSP.wetTapEnabled && chorusDSP.wetTapCallback != nullptr)
+    {
+        const float* wetLeft = block.getChannelPointer(0);
+        const float* wetRight = (numChannels >= 2) ? block.getChannelPointer(1) : nullptr;
+        chorusDSP.wetTapCallback(chorusDSP.wetTapContext, wetLeft, wetRight, blockNumSamples);
+    }
+
     chorusDSP.dryWet.mixWetSamples(block);
 }
@@ -33,5 +33,9 @@ public:
 private:
     static void processChorusParameters(ChorusDSP& chorusDSP, int blockNumSamples, float& currentDepth, float& currentRate, float& currentCentreDelayMs);
     static void processChorusLFO(ChorusDSP& chorusDSP, int blockNumSamples, int numChannels, float currentRate, float currentDepth);
+    // offsetCos/offsetSin hold the offset rotation applied to R: one value, or one per sample while it ramps.
+    static void processSpreadLFOs(ChorusDSP& chorusDSP, int numChannels, int startSample, int numSamples,
+                                  const float* offsetCos, const float* offsetSin, bool perSampleOffset);
     static void processChorusDelay(ChorusDSP& chorusDSP, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs);
+    static void processCoreDelay(ChorusDSP& chorusDSP, ChorusCore& core, juce::dsp::AudioBlock<float>& block, float currentCentreDelayMs);
 };
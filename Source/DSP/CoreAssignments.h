@@ -29,6 +29,7 @@ enum class CoreId : std::uint8_t
     orbit,
     linear,
     ensemble,
+    bbd_approx,
     count
 };
 
@@ -140,7 +141,8 @@ inline constexpr std::array<CorePackageDescriptor, coreIdCount()> kCorePackageDe
     { CoreId::phase_warp, "phase_warp", "Phase Warp", "Warp Macros", "purple warp", "Nonlinear phase-warp motion.", false, false, false, false, true, false, false },
     { CoreId::orbit, "orbit", "Orbit", "Orbit Macros", "purple orbit", "2D orbit motion path.", false, false, false, false, true, false, false },
     { CoreId::linear, "linear", "Linear", "Intensity Macros", "black intensity", "Fast linear interpolation intensity mode.", false, false, false, false, false, false, false },
-    { CoreId::ensemble, "ensemble", "Linear Ensemble", "Ensemble Macros", "black ensemble", "Dual-voice ensemble mode.", false, false, false, false, false, false, false }
+    { CoreId::ensemble, "ensemble", "Linear Ensemble", "Ensemble Macros", "black ensemble", "Dual-voice ensemble mode.", false, false, false, false, false, false, false },
+    { CoreId::bbd_approx, "bbd_approx", "BBD (Approx)", "BBD Macros", "red vintage bbd", "Approximated bucket-brigade mode: fractional delay with the BBD bandwidth, no stage emulation.", true, false, false, true, false, false, false }
 }};
 
 inline bool equalsIgnoreCase(std::string_view a, std::string_view b)
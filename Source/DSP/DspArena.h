@@ -0,0 +1,148 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+#if defined(__linux__) && defined(CHOROBOROS_DSP_ARENA_HUGE_PAGES)
+ #include <sys/mman.h>
+#endif
+
+namespace choroboros
+{
+class DspArena;
+
+// Slice of a DspArena handed out by reserve(). Usable once the arena is committed; spans stay
+// valid across a re-commit (they resolve through the arena), raw pointers taken from them do not.
+class ArenaSpan
+{
+public:
+    ArenaSpan() = default;
+
+    float* data() const noexcept;
+    size_t size() const noexcept { return count; }
+    float* begin() const noexcept { return data(); }
+    float* end() const noexcept { return data() + count; }
+    float& operator[](size_t index) const noexcept { return data()[index]; }
+
+private:
+    friend class DspArena;
+    ArenaSpan(const DspArena* owner, size_t byteOffset, size_t numFloats) noexcept
+        : arena(owner), offset(byteOffset), count(numFloats) {}
+
+    const DspArena* arena = nullptr;
+    size_t offset = 0;
+    size_t count = 0;
+};
+
+// One cache-line-aligned block holding every buffer of a ChorusDSP instance (core delay lines,
+// BBD stages, LFO and crossfade buffers). Laid out on the message thread in two phases:
+// beginLayout() then reserve() for each buffer, then commit() makes a single zeroed allocation
+// of exactly the reserved size. With CHOROBOROS_DSP_ARENA_HUGE_PAGES on Linux, arenas of 2 MB or
+// more are mmapped and advised for transparent huge pages.
+class DspArena
+{
+public:
+    static constexpr size_t kAlignment = 64;
+    static constexpr size_t kHugePageBytes = size_t { 2 } << 20;
+
+    DspArena() = default;
+    ~DspArena() { release(); }
+    DspArena(const DspArena&) = delete;
+    DspArena& operator=(const DspArena&) = delete;
+
+    void beginLayout() noexcept { layoutBytes = 0; }
+
+    ArenaSpan reserve(size_t numFloats) noexcept
+    {
+        const size_t offset = layoutBytes;
+        layoutBytes += alignUp(numFloats * sizeof(float));
+        return ArenaSpan(this, offset, numFloats);
+    }
+
+    // Replaces the previous block; spans from the finished layout resolve into the new one.
+    void commit()
+    {
+        release();
+        committedBytes = layoutBytes;
+        if (committedBytes == 0)
+            return;
+
+       #if defined(__linux__) && defined(CHOROBOROS_DSP_ARENA_HUGE_PAGES)
+        if (committedBytes >= kHugePageBytes)
+        {
+            mappedBytes = (committedBytes + kHugePageBytes - 1) & ~(kHugePageBytes - 1);
+            void* mapped = ::mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (mapped != MAP_FAILED)
+            {
+                ::madvise(mapped, mappedBytes, MADV_HUGEPAGE);
+                block = static_cast<unsigned char*>(mapped); // anonymous mappings are zero-filled
+                hugePages = true;
+                return;
+            }
+            mappedBytes = 0;
+        }
+       #endif
+
+        block = static_cast<unsigned char*>(::operator new(committedBytes, std::align_val_t { kAlignment }));
+        std::memset(block, 0, committedBytes);
+    }
+
+    float* floatsAt(size_t byteOffset) const noexcept
+    {
+        return reinterpret_cast<float*>(block + byteOffset);
+    }
+
+    size_t getFootprintBytes() const noexcept { return committedBytes; }
+    bool isHugePageBacked() const noexcept { return hugePages; }
+
+private:
+    static size_t alignUp(size_t bytes) noexcept { return (bytes + kAlignment - 1) & ~(kAlignment - 1); }
+
+    void release() noexcept
+    {
+        if (block == nullptr)
+            return;
+       #if defined(__linux__) && defined(CHOROBOROS_DSP_ARENA_HUGE_PAGES)
+        if (hugePages)
+            ::munmap(block, mappedBytes);
+        else
+       #endif
+            ::operator delete(block, std::align_val_t { kAlignment });
+        block = nullptr;
+        committedBytes = 0;
+        mappedBytes = 0;
+        hugePages = false;
+    }
+
+    unsigned char* block = nullptr;
+    size_t layoutBytes = 0;
+    size_t committedBytes = 0;
+    size_t mappedBytes = 0;
+    bool hugePages = false;
+};
+
+inline float* ArenaSpan::data() const noexcept
+{
+    return arena != nullptr ? arena->floatsAt(offset) : nullptr;
+}
+} // namespace choroboros
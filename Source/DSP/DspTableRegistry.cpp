@@ -0,0 +1,109 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "DspTableRegistry.h"
+
+namespace choroboros
+{
+DspTableRegistry::BuildThread::BuildThread(DspTableRegistry& ownerRegistry)
+    : juce::Thread("ChoroborosTableBuild"),
+      registry(ownerRegistry)
+{
+}
+
+void DspTableRegistry::BuildThread::run()
+{
+    for (;;)
+    {
+        Entry* entry = nullptr;
+        ErasedBuilder builder;
+        {
+            std::unique_lock<std::mutex> lock(registry.mutex);
+            registry.buildQueued.wait(lock, [this]
+            {
+                return registry.shuttingDown || !registry.pendingBuilds.empty();
+            });
+            if (registry.shuttingDown)
+                return;
+
+            entry = registry.pendingBuilds.front();
+            registry.pendingBuilds.pop_front();
+            builder = std::move(entry->builder);
+        }
+
+        // Built outside the lock; the entry node stays put because entries are never erased.
+        auto table = builder(entry->key);
+
+        {
+            const std::lock_guard<std::mutex> lock(registry.mutex);
+            entry->table = std::move(table);
+            entry->ready = true;
+            ++registry.numBuilds;
+        }
+        registry.buildFinished.notify_all();
+    }
+}
+
+DspTableRegistry::DspTableRegistry()
+    : buildThread(std::make_unique<BuildThread>(*this))
+{
+    buildThread->startThread(juce::Thread::Priority::background);
+}
+
+DspTableRegistry::~DspTableRegistry()
+{
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        shuttingDown = true;
+    }
+    buildQueued.notify_all();
+    buildThread->stopThread(2000);
+}
+
+std::shared_ptr<const void> DspTableRegistry::acquireErased(const Key& key, ErasedBuilder builder, bool waitUntilBuilt)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    auto [it, inserted] = entries.try_emplace(key);
+    Entry& entry = it->second;
+    if (inserted)
+    {
+        entry.key = key;
+        entry.builder = std::move(builder);
+        pendingBuilds.push_back(&entry);
+        buildQueued.notify_one();
+    }
+
+    if (!waitUntilBuilt)
+        return nullptr;
+
+    buildFinished.wait(lock, [&entry] { return entry.ready; });
+    return entry.table;
+}
+
+int DspTableRegistry::getNumTables() const
+{
+    const std::lock_guard<std::mutex> lock(mutex);
+    return static_cast<int>(entries.size());
+}
+
+int DspTableRegistry::getNumBuilds() const
+{
+    const std::lock_guard<std::mutex> lock(mutex);
+    return numBuilds;
+}
+} // namespace choroboros
@@ -0,0 +1,128 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+namespace choroboros
+{
+// Process-wide cache of immutable DSP tables (sinc kernels, crossfade curves, ...).
+// Shared by every plugin instance via juce::SharedResourcePointer. Each table is keyed by kind,
+// sample rate and two integer parameters, built exactly once on the registry's own thread and
+// then handed out as a shared const pointer, so N instances cost one copy.
+//
+// Not for the realtime path: acquire() may block until a build finishes. Call it from
+// constructors or prepare() and keep the returned pointer for the audio thread.
+class DspTableRegistry
+{
+public:
+    enum class TableKind
+    {
+        windowedSincKernel, // ChorusCoreThiran polyphase FIR (param0 = phases, param1 = taps)
+        coreCrossfadeCurve  // ChorusDSP core-switch gain curve (param0 = points)
+    };
+
+    struct Key
+    {
+        TableKind kind = TableKind::windowedSincKernel;
+        double sampleRate = 0.0; // 0 for rate-independent tables
+        int param0 = 0;
+        int param1 = 0;
+
+        bool operator<(const Key& other) const noexcept
+        {
+            return std::tie(kind, sampleRate, param0, param1)
+                 < std::tie(other.kind, other.sampleRate, other.param0, other.param1);
+        }
+    };
+
+    template <typename Table>
+    using Builder = std::unique_ptr<Table> (*)(const Key& key);
+
+    DspTableRegistry();
+    ~DspTableRegistry();
+
+    // Returns the table for key, waiting for the registry thread to build it the first time.
+    template <typename Table>
+    std::shared_ptr<const Table> acquire(const Key& key, Builder<Table> builder)
+    {
+        return std::static_pointer_cast<const Table>(acquireErased(key, eraseBuilder(builder), true));
+    }
+
+    // Queues the build without waiting, so a later acquire() usually finds the table ready.
+    template <typename Table>
+    void prefetch(const Key& key, Builder<Table> builder)
+    {
+        acquireErased(key, eraseBuilder(builder), false);
+    }
+
+    int getNumTables() const;
+    int getNumBuilds() const;
+
+private:
+    using ErasedBuilder = std::function<std::shared_ptr<const void>(const Key&)>;
+
+    template <typename Table>
+    static ErasedBuilder eraseBuilder(Builder<Table> builder)
+    {
+        return [builder](const Key& key) -> std::shared_ptr<const void>
+        {
+            return std::shared_ptr<const Table>(builder(key));
+        };
+    }
+
+    struct Entry
+    {
+        Key key;
+        ErasedBuilder builder;
+        std::shared_ptr<const void> table;
+        bool ready = false;
+    };
+
+    class BuildThread : public juce::Thread
+    {
+    public:
+        explicit BuildThread(DspTableRegistry& ownerRegistry);
+        void run() override;
+
+    private:
+        DspTableRegistry& registry;
+    };
+
+    std::shared_ptr<const void> acquireErased(const Key& key, ErasedBuilder builder, bool waitUntilBuilt);
+
+    mutable std::mutex mutex;
+    std::condition_variable buildQueued;
+    std::condition_variable buildFinished;
+    std::map<Key, Entry> entries;      // guarded by mutex; nodes are never erased
+    std::deque<Entry*> pendingBuilds;  // guarded by mutex
+    int numBuilds = 0;                 // guarded by mutex
+    bool shuttingDown = false;
+    std::unique_ptr<BuildThread> buildThread;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DspTableRegistry)
+};
+} // namespace choroboros
@@ -0,0 +1,135 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+namespace choroboros
+{
+// Fixed-bucket log-scale histogram of block processing time.
+// record() is wait-free (one relaxed fetch_add per counter) and safe on the audio thread;
+// readers take a relaxed copy of the counters, and reset() may run concurrently with recording.
+// Buckets cover 1 us .. ~1 s with 8 buckets per octave (~9% resolution).
+class LatencyHistogram
+{
+public:
+    static constexpr int kBucketsPerOctave = 8;
+    static constexpr int kOctaves = 20;
+    static constexpr int kNumBuckets = kBucketsPerOctave * kOctaves + 1; // last bucket = overflow
+    static constexpr double kMinSeconds = 1.0e-6;
+
+    struct Summary
+    {
+        std::uint64_t blocks = 0;
+        std::uint64_t deadlineMisses = 0;
+        float deadlineMissFraction = 0.0f;
+        double p50Ms = 0.0;
+        double p90Ms = 0.0;
+        double p99Ms = 0.0;
+        double p999Ms = 0.0;
+    };
+
+    // Records one block. deadlineSeconds <= 0 skips deadline accounting (offline renders).
+    void record(double processSeconds, double deadlineSeconds) noexcept
+    {
+        counts[static_cast<size_t>(bucketForSeconds(processSeconds))].fetch_add(1, std::memory_order_relaxed);
+        if (deadlineSeconds > 0.0
+            && processSeconds > deadlineSeconds * static_cast<double>(missFraction.load(std::memory_order_relaxed)))
+            deadlineMisses.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void reset() noexcept
+    {
+        for (auto& count : counts)
+            count.store(0, std::memory_order_relaxed);
+        deadlineMisses.store(0, std::memory_order_relaxed);
+    }
+
+    // Fraction of the block deadline above which a block counts as a miss (default: half the budget).
+    void setDeadlineMissFraction(float fraction) noexcept
+    {
+        missFraction.store(fraction > 0.0f ? fraction : 0.5f, std::memory_order_relaxed);
+    }
+    float getDeadlineMissFraction() const noexcept { return missFraction.load(std::memory_order_relaxed); }
+
+    std::uint64_t getBucketCount(int bucket) const noexcept
+    {
+        return counts[static_cast<size_t>(bucket)].load(std::memory_order_relaxed);
+    }
+
+    // Upper edge of a bucket in milliseconds (overflow bucket reports its lower edge).
+    static double bucketUpperMs(int bucket) noexcept
+    {
+        const int edge = bucket < kNumBuckets - 1 ? bucket + 1 : bucket;
+        return kMinSeconds * std::exp2(static_cast<double>(edge) / kBucketsPerOctave) * 1000.0;
+    }
+
+    static int bucketForSeconds(double seconds) noexcept
+    {
+        if (!(seconds > kMinSeconds))
+            return 0;
+        const int bucket = static_cast<int>(std::log2(seconds / kMinSeconds) * kBucketsPerOctave);
+        return bucket < kNumBuckets - 1 ? bucket : kNumBuckets - 1;
+    }
+
+    Summary summarise() const noexcept
+    {
+        std::array<std::uint64_t, kNumBuckets> snapshot {};
+        Summary summary;
+        for (int i = 0; i < kNumBuckets; ++i)
+        {
+            snapshot[static_cast<size_t>(i)] = getBucketCount(i);
+            summary.blocks += snapshot[static_cast<size_t>(i)];
+        }
+        summary.deadlineMisses = deadlineMisses.load(std::memory_order_relaxed);
+        summary.deadlineMissFraction = getDeadlineMissFraction();
+        if (summary.blocks == 0)
+            return summary;
+
+        summary.p50Ms = percentileMs(snapshot, summary.blocks, 0.5);
+        summary.p90Ms = percentileMs(snapshot, summary.blocks, 0.9);
+        summary.p99Ms = percentileMs(snapshot, summary.blocks, 0.99);
+        summary.p999Ms = percentileMs(snapshot, summary.blocks, 0.999);
+        return summary;
+    }
+
+private:
+    static double percentileMs(const std::array<std::uint64_t, kNumBuckets>& snapshot,
+                               std::uint64_t total,
+                               double quantile) noexcept
+    {
+        const auto rank = static_cast<std::uint64_t>(std::ceil(quantile * static_cast<double>(total)));
+        std::uint64_t cumulative = 0;
+        for (int i = 0; i < kNumBuckets; ++i)
+        {
+            cumulative += snapshot[static_cast<size_t>(i)];
+            if (cumulative >= rank)
+                return bucketUpperMs(i);
+        }
+        return bucketUpperMs(kNumBuckets - 1);
+    }
+
+    std::array<std::atomic<std::uint64_t>, kNumBuckets> counts {};
+    std::atomic<std::uint64_t> deadlineMisses { 0 };
+    std::atomic<float> missFraction { 0.5f };
+};
+} // namespace choroboros
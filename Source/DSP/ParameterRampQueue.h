@@ -0,0 +1,180 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace choroboros
+{
+// Lock-free linear ramps for a small fixed set of targets (console sweeps, scripted macros).
+// One producer thread pushes segments into a single-producer/single-consumer ring; the audio thread
+// drains it at the top of each block and steps the active ramps per sub-block, so ramps follow the
+// sample clock instead of UI timer ticks. A drained segment replaces whatever its target was doing.
+// cancel() may be called from any thread (parameter listeners run on the host's automation thread
+// too); it stops the target's ramp at the next drain, after any segment pushed before it.
+// Audio-side calls never allocate or block.
+template <int NumTargets>
+class ParameterRampQueue
+{
+public:
+    static constexpr int kCapacity = 64;
+    static constexpr int kAllTargets = -1;
+
+    struct Segment
+    {
+        int target = 0;              // kAllTargets only for stop requests
+        float startValue = 0.0f;
+        float endValue = 0.0f;
+        std::int64_t lengthSamples = 0; // <= 0 stops the target's ramp
+    };
+
+    // Producer side. Returns false if the ring is full or the target is out of range.
+    bool push(const Segment& segment) noexcept
+    {
+        if (segment.target < kAllTargets || segment.target >= NumTargets)
+            return false;
+        const int write = writeIndex.load(std::memory_order_relaxed);
+        const int next = (write + 1) % kCapacity;
+        if (next == readIndex.load(std::memory_order_acquire))
+            return false;
+        // A newer segment supersedes a cancel raised before it.
+        if (segment.target >= 0)
+            cancelRequests[static_cast<size_t>(segment.target)].store(false, std::memory_order_relaxed);
+        ring[static_cast<size_t>(write)] = segment;
+        writeIndex.store(next, std::memory_order_release);
+        return true;
+    }
+
+    bool stop(int target) noexcept
+    {
+        Segment segment;
+        segment.target = target;
+        return push(segment);
+    }
+
+    // Any thread.
+    void cancel(int target) noexcept
+    {
+        if (target >= 0 && target < NumTargets)
+            cancelRequests[static_cast<size_t>(target)].store(true, std::memory_order_release);
+    }
+
+    // Number of ramps the audio thread had running after its last drain/advance (any thread).
+    int getNumActive() const noexcept { return publishedActive.load(std::memory_order_relaxed); }
+
+    // Consumer side (audio thread).
+    void drain() noexcept
+    {
+        int read = readIndex.load(std::memory_order_relaxed);
+        const int write = writeIndex.load(std::memory_order_acquire);
+        while (read != write)
+        {
+            apply(ring[static_cast<size_t>(read)]);
+            read = (read + 1) % kCapacity;
+        }
+        readIndex.store(read, std::memory_order_release);
+
+        for (int target = 0; target < NumTargets; ++target)
+        {
+            auto& request = cancelRequests[static_cast<size_t>(target)];
+            if (request.load(std::memory_order_relaxed) && request.exchange(false, std::memory_order_acquire))
+                apply({ target, 0.0f, 0.0f, 0 });
+        }
+        publishActiveCount();
+    }
+
+    bool anyActive() const noexcept { return numActive > 0; }
+    bool isActive(int target) const noexcept { return ramps[static_cast<size_t>(target)].active; }
+
+    // Ramp value after the next numSamples samples (clamped to the segment end).
+    float valueAfter(int target, int numSamples) const noexcept
+    {
+        const auto& ramp = ramps[static_cast<size_t>(target)];
+        const std::int64_t position = std::min(ramp.position + numSamples, ramp.length);
+        const float alpha = static_cast<float>(static_cast<double>(position) / static_cast<double>(ramp.length));
+        return ramp.start + (ramp.end - ramp.start) * alpha;
+    }
+
+    void advance(int numSamples) noexcept
+    {
+        if (numActive == 0)
+            return;
+        for (auto& ramp : ramps)
+        {
+            if (!ramp.active)
+                continue;
+            ramp.position += numSamples;
+            if (ramp.position >= ramp.length)
+            {
+                ramp.active = false;
+                --numActive;
+            }
+        }
+        publishActiveCount();
+    }
+
+private:
+    struct Ramp
+    {
+        float start = 0.0f;
+        float end = 0.0f;
+        std::int64_t length = 1;
+        std::int64_t position = 0;
+        bool active = false;
+    };
+
+    void apply(const Segment& segment) noexcept
+    {
+        if (segment.target == kAllTargets)
+        {
+            for (auto& ramp : ramps)
+                ramp.active = false;
+            numActive = 0;
+            return;
+        }
+
+        auto& ramp = ramps[static_cast<size_t>(segment.target)];
+        const bool wasActive = ramp.active;
+        ramp.active = segment.lengthSamples > 0;
+        if (ramp.active)
+        {
+            ramp.start = segment.startValue;
+            ramp.end = segment.endValue;
+            ramp.length = segment.lengthSamples;
+            ramp.position = 0;
+        }
+        numActive += (ramp.active ? 1 : 0) - (wasActive ? 1 : 0);
+    }
+
+    void publishActiveCount() noexcept { publishedActive.store(numActive, std::memory_order_relaxed); }
+
+    std::array<Segment, kCapacity> ring {};
+    std::atomic<int> writeIndex { 0 };
+    std::atomic<int> readIndex { 0 };
+    std::atomic<int> publishedActive { 0 };
+    std::array<std::atomic<bool>, NumTargets> cancelRequests {};
+
+    // Audio-thread state.
+    std::array<Ramp, NumTargets> ramps {};
+    int numActive = 0;
+};
+} // namespace choroboros
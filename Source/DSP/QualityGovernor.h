@@ -0,0 +1,133 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+namespace choroboros
+{
+// CPU-budget governor for realtime processing.
+// Compares measured block time against the block deadline (numSamples / sampleRate) and walks
+// a ladder of cheaper options under sustained pressure, restoring quality once headroom returns.
+// Audio-thread only; all state is plain members and update() never allocates.
+class QualityGovernor
+{
+public:
+    enum class Level : int
+    {
+        full = 0,             // Everything on
+        analyzerTapsOff,      // Diagnostic taps skipped (inaudible)
+        reducedInterpolation, // Green HQ reads with Lagrange 3rd and Blue HQ with cubic (their NQ
+                              // interpolators); other cores have no cheaper read and are unaffected
+        coarseControlRate,    // Per-sample control work (LFO offset rotation) decimated
+        count
+    };
+
+    struct Transition
+    {
+        Level from = Level::full;
+        Level to = Level::full;
+        float loadRatio = 0.0f;
+    };
+
+    // Load ratio = block time / block deadline.
+    static constexpr float kStepDownLoad = 0.75f;
+    static constexpr float kStepUpLoad = 0.40f;
+    // Pressure must persist this long before stepping down, headroom this long before stepping up.
+    static constexpr double kStepDownHoldSeconds = 0.25;
+    static constexpr double kStepUpHoldSeconds = 3.0;
+    static constexpr double kLoadSmoothingSeconds = 0.1;
+
+    void reset() noexcept
+    {
+        level = Level::full;
+        smoothedLoad = 0.0f;
+        pressureSeconds = 0.0;
+        headroomSeconds = 0.0;
+    }
+
+    // Feed one measured block. Returns true and fills outTransition when the level changes.
+    bool update(double processSeconds, int numSamples, double sampleRate, Transition& outTransition) noexcept
+    {
+        if (numSamples <= 0 || sampleRate <= 0.0)
+            return false;
+
+        const double blockSeconds = static_cast<double>(numSamples) / sampleRate;
+        const float load = static_cast<float>(processSeconds / blockSeconds);
+        const float alpha = static_cast<float>(1.0 - std::exp(-blockSeconds / kLoadSmoothingSeconds));
+        smoothedLoad += alpha * (load - smoothedLoad);
+
+        if (smoothedLoad > kStepDownLoad)
+        {
+            pressureSeconds += blockSeconds;
+            headroomSeconds = 0.0;
+        }
+        else if (smoothedLoad < kStepUpLoad)
+        {
+            headroomSeconds += blockSeconds;
+            pressureSeconds = 0.0;
+        }
+        else
+        {
+            pressureSeconds = 0.0;
+            headroomSeconds = 0.0;
+        }
+
+        const int current = static_cast<int>(level);
+        int next = current;
+        if (pressureSeconds >= kStepDownHoldSeconds && current + 1 < static_cast<int>(Level::count))
+            next = current + 1;
+        else if (headroomSeconds >= kStepUpHoldSeconds && current > 0)
+            next = current - 1;
+
+        if (next == current)
+            return false;
+
+        outTransition.from = level;
+        outTransition.to = static_cast<Level>(next);
+        outTransition.loadRatio = smoothedLoad;
+        level = outTransition.to;
+        pressureSeconds = 0.0;
+        headroomSeconds = 0.0;
+        return true;
+    }
+
+    Level getLevel() const noexcept { return level; }
+    float getSmoothedLoad() const noexcept { return smoothedLoad; }
+
+    static const char* levelToToken(Level value) noexcept
+    {
+        switch (value)
+        {
+            case Level::full: return "full";
+            case Level::analyzerTapsOff: return "analyzer_taps_off";
+            case Level::reducedInterpolation: return "reduced_interpolation";
+            case Level::coarseControlRate: return "coarse_control_rate";
+            case Level::count: default: return "unknown";
+        }
+    }
+
+private:
+    Level level = Level::full;
+    float smoothedLoad = 0.0f;
+    double pressureSeconds = 0.0;
+    double headroomSeconds = 0.0;
+};
+} // namespace choroboros
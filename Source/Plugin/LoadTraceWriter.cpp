@@ -0,0 +1,133 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "LoadTraceWriter.h"
+#include "PluginProcessor.h"
+
+LoadTraceWriter::LoadTraceWriter()
+    : juce::Thread("ChoroborosLoadTrace")
+{
+    startThread(juce::Thread::Priority::background);
+}
+
+LoadTraceWriter::~LoadTraceWriter()
+{
+    stopThread(2000);
+    writePending();
+}
+
+void LoadTraceWriter::enqueue(const juce::String& eventName,
+                              double elapsedMs,
+                              std::uint64_t instanceId,
+                              const juce::String& notes)
+{
+    if (eventName.isEmpty())
+        return;
+
+    Event event;
+    event.tsUtc = juce::Time::getCurrentTime().toISO8601(true);
+    event.eventName = eventName;
+    event.elapsedMs = elapsedMs;
+    event.instanceId = instanceId;
+    event.notes = notes;
+
+    const juce::ScopedLock lock(queueLock);
+    pendingEvents.push_back(std::move(event));
+}
+
+void LoadTraceWriter::flush()
+{
+    writePending();
+}
+
+void LoadTraceWriter::run()
+{
+    while (!threadShouldExit())
+    {
+        wait(flushIntervalMs);
+        writePending();
+    }
+}
+
+void LoadTraceWriter::cacheProcessFacts()
+{
+    if (processFactsCached)
+        return;
+    processFactsCached = true;
+
+    logFile = ChoroborosAudioProcessor::getLoadTraceLogFile();
+
+    const juce::PluginHostType hostType;
+    const juce::String hostDescription(hostType.getHostDescription());
+    const auto wrapperType = juce::PluginHostType::getPluginLoadedAs();
+    processFacts.set("host", hostDescription.isNotEmpty() ? hostDescription : juce::String("Unknown"));
+    processFacts.set("hostPath", juce::PluginHostType::getHostPath());
+    processFacts.set("wrapperType", juce::String(juce::AudioProcessor::getWrapperTypeDescription(wrapperType)));
+    processFacts.set("pluginVersion", juce::String(JucePlugin_VersionString));
+   #if JUCE_DEBUG
+    processFacts.set("buildConfig", "debug");
+   #else
+    processFacts.set("buildConfig", "release");
+   #endif
+    processFacts.set("os", juce::SystemStats::getOperatingSystemName());
+    processFacts.set("isOS64Bit", juce::SystemStats::isOperatingSystem64Bit());
+    processFacts.set("cpuVendor", juce::SystemStats::getCpuVendor());
+    processFacts.set("cpuModel", juce::SystemStats::getCpuModel());
+    processFacts.set("cpuSpeedMHz", juce::SystemStats::getCpuSpeedInMegahertz());
+    processFacts.set("cpuCores", juce::SystemStats::getNumCpus());
+    processFacts.set("ramMB", juce::SystemStats::getMemorySizeInMegabytes());
+}
+
+void LoadTraceWriter::writePending()
+{
+    const juce::ScopedLock writeGuard(writeLock);
+
+    std::vector<Event> batch;
+    {
+        const juce::ScopedLock lock(queueLock);
+        batch.swap(pendingEvents);
+    }
+    if (batch.empty())
+        return;
+
+    cacheProcessFacts();
+    if (!logFile.getParentDirectory().createDirectory())
+        return;
+
+    juce::String text;
+    for (const auto& event : batch)
+    {
+        juce::var payload(new juce::DynamicObject());
+        auto* object = payload.getDynamicObject();
+        if (object == nullptr)
+            continue;
+
+        object->setProperty("tsUtc", event.tsUtc);
+        object->setProperty("event", event.eventName);
+        object->setProperty("elapsedMs", juce::roundToInt(event.elapsedMs * 1000.0) / 1000.0);
+        object->setProperty("instanceId", static_cast<juce::int64>(event.instanceId));
+        for (const auto& fact : processFacts)
+            object->setProperty(fact.name, fact.value);
+        if (event.notes.isNotEmpty())
+            object->setProperty("notes", event.notes);
+
+        text << juce::JSON::toString(payload, true) << "\n";
+    }
+
+    logFile.appendText(text, false, false, nullptr);
+}
@@ -0,0 +1,71 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Process-wide background writer for load_trace.ndjson.
+ * Shared by all plugin instances via juce::SharedResourcePointer. enqueue() only takes a short
+ * lock and appends to a vector; the writer thread batches queued events into one append per
+ * flush. Host and system facts (CPU, RAM, OS, host path) are gathered once, on the writer thread.
+ */
+class LoadTraceWriter : private juce::Thread
+{
+public:
+    LoadTraceWriter();
+    ~LoadTraceWriter() override;
+
+    void enqueue(const juce::String& eventName,
+                 double elapsedMs,
+                 std::uint64_t instanceId,
+                 const juce::String& notes);
+
+    // Blocks until everything queued so far is on disk (tests and shutdown paths only).
+    void flush();
+
+private:
+    struct Event
+    {
+        juce::String tsUtc;
+        juce::String eventName;
+        double elapsedMs = 0.0;
+        std::uint64_t instanceId = 0;
+        juce::String notes;
+    };
+
+    static constexpr int flushIntervalMs = 500;
+
+    void run() override;
+    void writePending();
+    void cacheProcessFacts();
+
+    juce::CriticalSection queueLock;
+    std::vector<Event> pendingEvents;   // guarded by queueLock
+    juce::CriticalSection writeLock;    // serialises writePending() between thread and flush()
+
+    // Written once by cacheProcessFacts() under writeLock.
+    bool processFactsCached = false;
+    juce::File logFile;
+    juce::NamedValueSet processFacts;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LoadTraceWriter)
+};
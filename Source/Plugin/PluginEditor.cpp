@@ -32,25 +32,6 @@
 
 namespace
 {
-struct BackgroundAssetPack
-{
-    juce::Image off;
-    juce::Image lit;
-};
-
-struct SharedBackgroundCache
-{
-    juce::CriticalSection lock;
-    std::array<BackgroundAssetPack, 5> packs {};
-    std::array<bool, 5> valid { false, false, false, false, false };
-};
-
-SharedBackgroundCache& getSharedBackgroundCache()
-{
-    static SharedBackgroundCache cache;
-    return cache;
-}
-
 int uiScaleInt(int value)
 {
     return juce::roundToInt(static_cast<float>(value) * ChoroborosPluginEditor::kUiScale);
@@ -71,15 +52,11 @@ int getIntOrDefault(const juce::var& objectVar, const juce::Identifier& key, int
 
 void loadPersistedLayoutDefaults(LayoutTuning& layout)
 {
-    const auto json = DefaultsPersistence::load();
-    if (json.isEmpty())
-        return;
-
-    const auto parsed = juce::JSON::parse(json);
-    if (parsed.isVoid())
+    const auto parsed = DefaultsPersistence::loadParsed();
+    if (parsed == nullptr)
         return;
 
-    const auto* root = parsed.getDynamicObject();
+    const auto* root = parsed->getDynamicObject();
     if (root == nullptr || !root->hasProperty("layout"))
         return;
 
@@ -482,86 +459,15 @@ void loadPersistedLayoutDefaults(LayoutTuning& layout)
     }
 }
 
-BackgroundAssetPack decodeBackgroundAssetPack(int colorIndex)
-{
-    colorIndex = juce::jlimit(0, 4, colorIndex);
-    const char* offName = nullptr;
-    int offSize = 0;
-    const char* onName = nullptr;
-    int onSize = 0;
-
-    if (colorIndex == 0) // Green
-    {
-        offName = BinaryData::green_light_off_backpanel_png;
-        offSize = BinaryData::green_light_off_backpanel_pngSize;
-        onName = BinaryData::green_light_on_backpanel_png;
-        onSize = BinaryData::green_light_on_backpanel_pngSize;
-    }
-    else if (colorIndex == 1) // Blue
-    {
-        offName = BinaryData::blue_light_off_backpanel_png;
-        offSize = BinaryData::blue_light_off_backpanel_pngSize;
-        onName = BinaryData::blue_light_on_backpanel_png;
-        onSize = BinaryData::blue_light_on_backpanel_pngSize;
-    }
-    else if (colorIndex == 2) // Red
-    {
-        offName = BinaryData::red_light_off_backpanel_png;
-        offSize = BinaryData::red_light_off_backpanel_pngSize;
-        onName = BinaryData::red_light_on_backpanel_png;
-        onSize = BinaryData::red_light_on_backpanel_pngSize;
-    }
-    else if (colorIndex == 3) // Purple
-    {
-        offName = BinaryData::purple_light_off_backpanel_png;
-        offSize = BinaryData::purple_light_off_backpanel_pngSize;
-        onName = BinaryData::purple_light_on_backpanel_png;
-        onSize = BinaryData::purple_light_on_backpanel_pngSize;
-    }
-    else // Black (colorIndex == 4)
-    {
-        offName = BinaryData::black_light_off_backpanel_png;
-        offSize = BinaryData::black_light_off_backpanel_pngSize;
-        onName = BinaryData::black_light_on_backpanel_png;
-        onSize = BinaryData::black_light_on_backpanel_pngSize;
-    }
-
-    BackgroundAssetPack pack;
-    if (offName && offSize > 0)
-        pack.off = juce::ImageCache::getFromMemory(offName, offSize);
-    if (onName && onSize > 0)
-        pack.lit = juce::ImageCache::getFromMemory(onName, onSize);
-    return pack;
-}
-
-BackgroundAssetPack getOrDecodeBackgroundAssetPack(int colorIndex)
+ThemeAssetCache::BackgroundPack getOrDecodeBackgroundAssetPack(int colorIndex)
 {
-    colorIndex = juce::jlimit(0, 4, colorIndex);
-    const auto index = static_cast<size_t>(colorIndex);
-    auto& cache = getSharedBackgroundCache();
-
-    {
-        const juce::ScopedLock lock(cache.lock);
-        if (cache.valid[index])
-            return cache.packs[index];
-    }
-
-    auto decoded = decodeBackgroundAssetPack(colorIndex);
-    {
-        const juce::ScopedLock lock(cache.lock);
-        if (!cache.valid[index])
-        {
-            cache.packs[index] = decoded;
-            cache.valid[index] = true;
-        }
-        return cache.packs[index];
-    }
+    return juce::SharedResourcePointer<ThemeAssetCache>()->getBackgroundPack(colorIndex);
 }
 
 class DevPanelWindow : public juce::DocumentWindow
 {
 public:
-    DevPanelWindow(ChoroborosPluginEditor& editor, ChoroborosAudioProcessor& processor)
+    DevPanelWindow(ChoroborosPluginEditor& editor, ChoroborosAudioProcessor& processor, bool deferContentUntilShown)
         : juce::DocumentWindow("Choroboros Dev Panel",
                                juce::Colour(0xff202020),
                                juce::DocumentWindow::closeButton)
@@ -570,7 +476,7 @@ public:
         setResizable(true, true);
         setResizeLimits(1028, 525, 8192, 8192);
         setAlwaysOnTop(true);
-        setContentOwned(new DevPanel(editor, processor), true);
+        setContentOwned(new DevPanel(editor, processor, deferContentUntilShown), true);
         centreAroundComponent(&editor, 900, 700);
     }
 
@@ -578,6 +484,15 @@ public:
     {
         setVisible(false);
     }
+
+    void visibilityChanged() override
+    {
+        juce::DocumentWindow::visibilityChanged();
+        // A prewarmed window defers its tab content until the first time it is actually shown.
+        if (isVisible())
+            if (auto* panel = dynamic_cast<DevPanel*>(getContentComponent()))
+                panel->buildDeferredContent();
+    }
 };
 } // namespace
 
@@ -592,10 +507,17 @@ ChoroborosPluginEditor::ChoroborosPluginEditor (ChoroborosAudioProcessor& p)
     if (auto* engineColorParam = audioProcessor.getValueTreeState().getRawParameterValue(ChoroborosAudioProcessor::ENGINE_COLOR_ID))
         initialEngineIndex = juce::jlimit(0, 4, static_cast<int>(engineColorParam->load()));
 
+    // Baked knob frames are sized for a fixed pixel density; denser displays keep the PNG sheets.
+    float displayScale = juce::Desktop::getInstance().getGlobalScaleFactor();
+    if (const auto* display = juce::Desktop::getInstance().getDisplays().getPrimaryDisplay())
+        displayScale *= static_cast<float>(display->scale);
+    const bool useBakedSprites = CustomLookAndFeel::shouldUseBakedSprites(displayScale);
+    customLookAndFeel.setUseBakedSprites(useBakedSprites);
+
     activeThemeDecodeColorIndex = initialEngineIndex;
-    activeThemeDecodeFuture = std::async(std::launch::async, [initialEngineIndex]()
+    activeThemeDecodeFuture = std::async(std::launch::async, [initialEngineIndex, useBakedSprites]()
     {
-        return CustomLookAndFeel::getOrDecodeThemeAssetPack(initialEngineIndex);
+        return CustomLookAndFeel::getOrDecodeThemeAssetPack(initialEngineIndex, useBakedSprites);
     });
 
     const double fontSetupStartMs = juce::Time::getMillisecondCounterHiRes();
@@ -613,7 +535,7 @@ ChoroborosPluginEditor::ChoroborosPluginEditor (ChoroborosAudioProcessor& p)
     
     const double themeSetupStartMs = juce::Time::getMillisecondCounterHiRes();
     setupEngineColorSelector();
-    if (CustomLookAndFeel::isThemeAssetPackCached(initialEngineIndex))
+    if (CustomLookAndFeel::isThemeAssetPackCached(initialEngineIndex, useBakedSprites))
     {
         customLookAndFeel.setColorTheme(initialEngineIndex);
         activeThemeInstalled = true;
@@ -744,24 +666,12 @@ ChoroborosPluginEditor::ChoroborosPluginEditor (ChoroborosAudioProcessor& p)
 
 void ChoroborosPluginEditor::loadValueLabelTypeface()
 {
-    if (BinaryData::Technology_ttfSize <= 0)
-        return;
-
-    static juce::Typeface::Ptr cachedValueLabelTypeface = juce::Typeface::createSystemTypefaceFor(
-        BinaryData::Technology_ttf,
-        static_cast<size_t>(BinaryData::Technology_ttfSize));
-    valueLabelTypeface = cachedValueLabelTypeface;
+    valueLabelTypeface = juce::SharedResourcePointer<ThemeAssetCache>()->getValueLabelTypeface();
 }
 
 void ChoroborosPluginEditor::loadUiTextTypeface()
 {
-    if (BinaryData::Retroica_ttfSize <= 0)
-        return;
-
-    static juce::Typeface::Ptr cachedUiTypeface = juce::Typeface::createSystemTypefaceFor(
-        BinaryData::Retroica_ttf,
-        static_cast<size_t>(BinaryData::Retroica_ttfSize));
-    uiTextTypeface = cachedUiTypeface;
+    uiTextTypeface = juce::SharedResourcePointer<ThemeAssetCache>()->getUiTextTypeface();
 }
 
 juce::Font ChoroborosPluginEditor::makeValueLabelFont(float heightPx, bool bold) const
@@ -979,8 +889,9 @@ void ChoroborosPluginEditor::startDeferredThemePrewarm(int activeColorIndex)
     stopThemePrewarm.store(false);
     juce::Component::SafePointer<ChoroborosPluginEditor> safeThis(this);
     std::atomic<bool>* stopFlag = &stopThemePrewarm;
+    const bool useBakedSprites = customLookAndFeel.isUsingBakedSprites();
 
-    themePrewarmThread = std::thread([safeThis, stopFlag, activeColorIndex]()
+    themePrewarmThread = std::thread([safeThis, stopFlag, activeColorIndex, useBakedSprites]()
     {
         std::array<int, 5> prewarmOrder { activeColorIndex, 0, 1, 2, 3 };
         int orderCursor = 1;
@@ -999,7 +910,7 @@ void ChoroborosPluginEditor::startDeferredThemePrewarm(int activeColorIndex)
 
             const int colorIndex = prewarmOrder[static_cast<size_t>(i)];
             auto backgroundPack = getOrDecodeBackgroundAssetPack(colorIndex);
-            auto pack = CustomLookAndFeel::getOrDecodeThemeAssetPack(colorIndex);
+            auto pack = CustomLookAndFeel::getOrDecodeThemeAssetPack(colorIndex, useBakedSprites);
 
             if (stopFlag->load())
                 return;
@@ -1038,7 +949,7 @@ void ChoroborosPluginEditor::ensureDevPanelWindowCreated(bool triggeredByUser)
         return;
 
     const double startMs = juce::Time::getMillisecondCounterHiRes();
-    devWindow = std::make_unique<DevPanelWindow>(*this, audioProcessor);
+    devWindow = std::make_unique<DevPanelWindow>(*this, audioProcessor, !triggeredByUser);
 
     const juce::String eventName = triggeredByUser
         ? "editor_devpanel_create_on_demand_ms"
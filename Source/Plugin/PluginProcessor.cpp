@@ -18,12 +18,14 @@
 
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+#include "PluginStateCodec.h"
 #include "../DSP/ChorusDSP.h"
 #include "../Config/DefaultsPersistence.h"
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 
 namespace BinaryData
 {
@@ -60,64 +62,6 @@ std::uint64_t nextLoadTraceInstanceId()
     return getLoadTraceInstanceCounter().fetch_add(1, std::memory_order_relaxed);
 }
 
-juce::CriticalSection& getLoadTraceFileLock()
-{
-    static juce::CriticalSection lock;
-    return lock;
-}
-
-juce::String getSafeHostDescription()
-{
-    const juce::PluginHostType hostType;
-    const juce::String hostDescription(hostType.getHostDescription());
-    return hostDescription.isNotEmpty() ? hostDescription : juce::String("Unknown");
-}
-
-void appendLoadTraceLine(const ChoroborosAudioProcessor& processor,
-                         const juce::String& eventName,
-                         double elapsedMs,
-                         const juce::String& notes)
-{
-    if (eventName.isEmpty())
-        return;
-
-    const juce::ScopedLock lock(getLoadTraceFileLock());
-    const auto logFile = ChoroborosAudioProcessor::getLoadTraceLogFile();
-    if (!logFile.getParentDirectory().createDirectory())
-        return;
-
-    juce::var payload(new juce::DynamicObject());
-    auto* object = payload.getDynamicObject();
-    if (object == nullptr)
-        return;
-
-    const auto wrapperType = juce::PluginHostType::getPluginLoadedAs();
-    object->setProperty("tsUtc", juce::Time::getCurrentTime().toISO8601(true));
-    object->setProperty("event", eventName);
-    object->setProperty("elapsedMs", juce::roundToInt(elapsedMs * 1000.0) / 1000.0);
-    object->setProperty("instanceId", static_cast<juce::int64>(processor.getInstanceId()));
-    object->setProperty("host", getSafeHostDescription());
-    object->setProperty("hostPath", juce::PluginHostType::getHostPath());
-    object->setProperty("wrapperType", juce::String(juce::AudioProcessor::getWrapperTypeDescription(wrapperType)));
-    object->setProperty("pluginVersion", juce::String(JucePlugin_VersionString));
-   #if JUCE_DEBUG
-    object->setProperty("buildConfig", "debug");
-   #else
-    object->setProperty("buildConfig", "release");
-   #endif
-    object->setProperty("os", juce::SystemStats::getOperatingSystemName());
-    object->setProperty("isOS64Bit", juce::SystemStats::isOperatingSystem64Bit());
-    object->setProperty("cpuVendor", juce::SystemStats::getCpuVendor());
-    object->setProperty("cpuModel", juce::SystemStats::getCpuModel());
-    object->setProperty("cpuSpeedMHz", juce::SystemStats::getCpuSpeedInMegahertz());
-    object->setProperty("cpuCores", juce::SystemStats::getNumCpus());
-    object->setProperty("ramMB", juce::SystemStats::getMemorySizeInMegabytes());
-    if (notes.isNotEmpty())
-        object->setProperty("notes", notes);
-
-    logFile.appendText(juce::JSON::toString(payload, false) + "\n", false, false, nullptr);
-}
-
 juce::String buildStartupParamSnapshotNotes(ChoroborosAudioProcessor& processor, const juce::String& sourceTag)
 {
     auto& valueTreeState = processor.getValueTreeState();
@@ -159,19 +103,6 @@ double getNumberOrDefault(const juce::var& objectVar, const juce::Identifier& ke
     return fallback;
 }
 
-juce::var buildCoreAssignmentsVar(const choroboros::CoreAssignmentTable& table)
-{
-    auto* root = new juce::DynamicObject();
-    for (int engine = 0; engine < choroboros::kEngineColorCount; ++engine)
-    {
-        auto* engineNode = new juce::DynamicObject();
-        engineNode->setProperty("nq", juce::String(choroboros::coreIdToToken(table.get(engine, false))));
-        engineNode->setProperty("hq", juce::String(choroboros::coreIdToToken(table.get(engine, true))));
-        root->setProperty(juce::String(choroboros::kEngineColorTokens[static_cast<std::size_t>(engine)]), juce::var(engineNode));
-    }
-    return juce::var(root);
-}
-
 bool parseCoreAssignmentsFromVar(const juce::var& assignmentsVar, choroboros::CoreAssignmentTable& outTable)
 {
     outTable.resetToLegacy();
@@ -214,11 +145,6 @@ bool parseCoreAssignmentsFromVar(const juce::var& assignmentsVar, choroboros::Co
     return anyLoaded;
 }
 
-juce::String encodeCoreAssignmentsForStateProperty(const choroboros::CoreAssignmentTable& table)
-{
-    return juce::JSON::toString(buildCoreAssignmentsVar(table), false);
-}
-
 bool decodeCoreAssignmentsFromStateProperty(const juce::String& text, choroboros::CoreAssignmentTable& outTable)
 {
     const auto parsed = juce::JSON::parse(text);
@@ -582,15 +508,11 @@ void copyRuntimeTuningValues(const ChorusDSP::RuntimeTuning& src, ChorusDSP::Run
 
 void loadPersistedDefaults(ChoroborosAudioProcessor& processor)
 {
-    const auto json = DefaultsPersistence::load();
-    if (json.isEmpty())
-        return;
-
-    const auto parsed = juce::JSON::parse(json);
-    if (parsed.isVoid())
+    const auto parsed = DefaultsPersistence::loadParsed();
+    if (parsed == nullptr)
         return;
 
-    const auto* root = parsed.getDynamicObject();
+    const auto* root = parsed->getDynamicObject();
     if (root == nullptr)
         return;
 
@@ -709,6 +631,31 @@ void loadPersistedDefaults(ChoroborosAudioProcessor& processor)
         processor.loadEngineParamProfilesFromVar(root->getProperty("engineParamProfiles"));
 }
 
+// Parameter order of the binary state chunk (version 1). Engine and HQ come first so the
+// remaining values land on the restored engine, as in resetToFactoryDefaults().
+constexpr std::array<const char*, PluginStateCodec::kNumParameters> binaryStateParameterOrder {
+    ChoroborosAudioProcessor::ENGINE_COLOR_ID,
+    ChoroborosAudioProcessor::HQ_ID,
+    ChoroborosAudioProcessor::RATE_ID,
+    ChoroborosAudioProcessor::DEPTH_ID,
+    ChoroborosAudioProcessor::OFFSET_ID,
+    ChoroborosAudioProcessor::WIDTH_ID,
+    ChoroborosAudioProcessor::COLOR_ID,
+    ChoroborosAudioProcessor::MIX_ID
+};
+
+const char* stateDecodeResultToToken(PluginStateCodec::DecodeResult result)
+{
+    switch (result)
+    {
+        case PluginStateCodec::DecodeResult::ok: return "binary";
+        case PluginStateCodec::DecodeResult::notBinary: return "xml";
+        case PluginStateCodec::DecodeResult::corrupt: return "corrupt";
+        case PluginStateCodec::DecodeResult::unsupportedVersion: return "unsupported_version";
+        default: return "unknown";
+    }
+}
+
 void seedPersistedDefaultsFromBundledFactory()
 {
 #if JUCE_MAC || JUCE_WINDOWS
@@ -743,53 +690,176 @@ void seedPersistedDefaultsFromBundledFactory()
 }
 } // namespace
 
-void ChoroborosAudioProcessor::StereoTapRingBuffer::clear() noexcept
+void ChoroborosAudioProcessor::AnalyzerTapRing::clear() noexcept
 {
-    std::fill(left.begin(), left.end(), 0.0f);
-    std::fill(right.begin(), right.end(), 0.0f);
-    writeIndex.store(0, std::memory_order_relaxed);
+    // Indices stay monotonic so an attached reader simply sees silence rather than a rewind.
+    for (auto& lane : lanes)
+        std::fill(lane.begin(), lane.end(), 0.0f);
 }
 
-void ChoroborosAudioProcessor::StereoTapRingBuffer::push(const float* leftIn, const float* rightIn, int numSamples) noexcept
+void ChoroborosAudioProcessor::AnalyzerTapRing::beginWrite(int numSamples) noexcept
 {
-    if (numSamples <= 0 || leftIn == nullptr)
-        return;
+    const auto write = writeIndex.load(std::memory_order_relaxed);
+    reserveIndex.store(write + static_cast<std::uint64_t>(numSamples), std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void ChoroborosAudioProcessor::AnalyzerTapRing::writeLane(int lane, const float* source, int numSamples, int offset) noexcept
+{
+    auto& destination = lanes[static_cast<size_t>(lane)];
+    const auto write = writeIndex.load(std::memory_order_relaxed) + static_cast<std::uint64_t>(offset);
+    const auto start = static_cast<std::uint32_t>(write & (capacity - 1u));
+    const int first = juce::jmin(numSamples, static_cast<int>(capacity - start));
+    const int second = numSamples - first;
+    const auto firstBytes = static_cast<size_t>(first) * sizeof(float);
+    const auto secondBytes = static_cast<size_t>(second) * sizeof(float);
 
-    auto write = writeIndex.load(std::memory_order_relaxed);
-    for (int i = 0; i < numSamples; ++i)
+    if (source != nullptr)
+    {
+        std::memcpy(destination.data() + start, source, firstBytes);
+        std::memcpy(destination.data(), source + first, secondBytes);
+    }
+    else
     {
-        const std::uint32_t slot = static_cast<std::uint32_t>((write + static_cast<std::uint64_t>(i)) & (capacity - 1u));
-        left[slot] = leftIn[i];
-        right[slot] = (rightIn != nullptr) ? rightIn[i] : leftIn[i];
+        std::memset(destination.data() + start, 0, firstBytes);
+        std::memset(destination.data(), 0, secondBytes);
     }
+}
+
+void ChoroborosAudioProcessor::AnalyzerTapRing::endWrite(int numSamples) noexcept
+{
+    const auto write = writeIndex.load(std::memory_order_relaxed);
     writeIndex.store(write + static_cast<std::uint64_t>(numSamples), std::memory_order_release);
 }
 
-void ChoroborosAudioProcessor::StereoTapRingBuffer::copyLatest(float* leftOut, float* rightOut, int numSamples) const noexcept
+bool ChoroborosAudioProcessor::AnalyzerTapRing::copyRange(int lane, std::uint64_t startIndex, float* destination, int numSamples) const noexcept
 {
-    if (numSamples <= 0 || leftOut == nullptr || rightOut == nullptr)
-        return;
+    if (numSamples <= 0)
+        return true;
+
+    const auto& source = lanes[static_cast<size_t>(lane)];
+    const auto start = static_cast<std::uint32_t>(startIndex & (capacity - 1u));
+    const int first = juce::jmin(numSamples, static_cast<int>(capacity - start));
+    std::memcpy(destination, source.data() + start, static_cast<size_t>(first) * sizeof(float));
+    std::memcpy(destination + first, source.data(), static_cast<size_t>(numSamples - first) * sizeof(float));
+
+    // Seqlock-style validation: any slot the writer may have touched is older than reserve - capacity.
+    // If the writer got that far the destination may be torn, and the caller must discard it.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const auto reserve = reserveIndex.load(std::memory_order_relaxed);
+    return reserve <= startIndex + capacity;
+}
+
+// Sliding analysis frames for the three taps plus the FFT workspace.
+// Each pass pulls only the samples written since the previous pass; the spectrum is an STFT
+// with hopSize advance, so passes that see less than a hop of new audio reuse the last frame.
+struct ChoroborosAudioProcessor::AnalyzerHistory
+{
+    static constexpr int frameSize = ANALYZER_FFT_SIZE;
+    static constexpr int hopSize = ANALYZER_FFT_SIZE / 4; // 75% overlap
 
-    const int clampedSamples = juce::jmin(numSamples, static_cast<int>(capacity));
-    const auto write = writeIndex.load(std::memory_order_acquire);
-    const int available = static_cast<int>(juce::jmin<std::uint64_t>(write, capacity));
-    const int toCopy = juce::jmin(clampedSamples, available);
-    const int zeroPrefix = clampedSamples - toCopy;
+    struct Stream
+    {
+        std::array<float, frameSize> left {};
+        std::array<float, frameSize> right {};
+    };
 
-    for (int i = 0; i < zeroPrefix; ++i)
+    // Slides all three frames by the samples written since the last pass. Returns how many new
+    // samples arrived. A torn read (the writer lapped us) falls back to re-reading the newest
+    // frame; if that is torn as well the pass is skipped and the next one resynchronises.
+    int pull(const AnalyzerTapRing& ring) noexcept
     {
-        leftOut[i] = 0.0f;
-        rightOut[i] = 0.0f;
+        for (int attempt = 0; attempt < 2; ++attempt)
+        {
+            const auto write = ring.getWriteIndex();
+            const auto pending = write - readCursor;
+            if (pending == 0)
+                return 0;
+
+            const bool slide = !needsResync && pending < static_cast<std::uint64_t>(frameSize);
+            const int fresh = slide ? static_cast<int>(pending)
+                                    : static_cast<int>(juce::jmin<std::uint64_t>(write, static_cast<std::uint64_t>(frameSize)));
+            const int kept = frameSize - fresh;
+            const auto readStart = write - static_cast<std::uint64_t>(fresh);
+
+            bool intact = true;
+            Stream* const streams[] = { &input, &wet, &output };
+            for (int s = 0; s < 3; ++s)
+            {
+                auto& stream = *streams[s];
+                if (slide)
+                {
+                    std::memmove(stream.left.data(), stream.left.data() + fresh, static_cast<size_t>(kept) * sizeof(float));
+                    std::memmove(stream.right.data(), stream.right.data() + fresh, static_cast<size_t>(kept) * sizeof(float));
+                }
+                else
+                {
+                    std::fill(stream.left.begin(), stream.left.begin() + kept, 0.0f);
+                    std::fill(stream.right.begin(), stream.right.begin() + kept, 0.0f);
+                }
+
+                intact = ring.copyRange(AnalyzerTapRing::inputLeft + 2 * s, readStart, stream.left.data() + kept, fresh) && intact;
+                intact = ring.copyRange(AnalyzerTapRing::inputRight + 2 * s, readStart, stream.right.data() + kept, fresh) && intact;
+            }
+
+            if (intact)
+            {
+                readCursor = write;
+                needsResync = false;
+                return fresh;
+            }
+            needsResync = true;
+        }
+        return 0;
     }
 
-    const auto readStart = write - static_cast<std::uint64_t>(toCopy);
-    for (int i = 0; i < toCopy; ++i)
+    AnalyzerHistory()
     {
-        const std::uint32_t slot = static_cast<std::uint32_t>((readStart + static_cast<std::uint64_t>(i)) & (capacity - 1u));
-        leftOut[zeroPrefix + i] = left[slot];
-        rightOut[zeroPrefix + i] = right[slot];
+        juce::dsp::WindowingFunction<float>::fillWindowingTables(window.data(), static_cast<size_t>(frameSize),
+                                                                 juce::dsp::WindowingFunction<float>::hann, true);
     }
-}
+
+    // Packs two real frames into one complex FFT (a + jb) and unpacks both magnitude spectra:
+    // A[k] = (Z[k] + conj(Z[N-k])) / 2, B[k] = (Z[k] - conj(Z[N-k])) / 2j.
+    void computePairMagnitudes(const Stream& first, const Stream* second,
+                               std::array<float, frameSize / 2>& firstOut,
+                               std::array<float, frameSize / 2>& secondOut) noexcept
+    {
+        for (int i = 0; i < frameSize; ++i)
+        {
+            const auto idx = static_cast<size_t>(i);
+            const float w = 0.5f * window[idx];
+            const float re = w * (first.left[idx] + first.right[idx]);
+            const float im = (second != nullptr) ? w * (second->left[idx] + second->right[idx]) : 0.0f;
+            packed[idx] = { re, im };
+        }
+
+        fft.perform(packed.data(), transformed.data(), false);
+
+        for (int k = 0; k < frameSize / 2; ++k)
+        {
+            const auto zk = transformed[static_cast<size_t>(k)];
+            const auto zn = std::conj(transformed[static_cast<size_t>((frameSize - k) & (frameSize - 1))]);
+            firstOut[static_cast<size_t>(k)] = 0.5f * std::abs(zk + zn);
+            secondOut[static_cast<size_t>(k)] = 0.5f * std::abs(zk - zn);
+        }
+    }
+
+    Stream input;
+    Stream wet;
+    Stream output;
+    std::uint64_t readCursor = 0;
+    bool needsResync = true;
+    int samplesSinceSpectrum = frameSize; // First pass with demand always analyses a frame.
+    juce::dsp::FFT fft { ANALYZER_FFT_ORDER };
+    std::array<float, frameSize> window {};
+    std::array<juce::dsp::Complex<float>, frameSize> packed {};
+    std::array<juce::dsp::Complex<float>, frameSize> transformed {};
+    std::array<float, frameSize / 2> inputMagnitudes {};
+    std::array<float, frameSize / 2> wetMagnitudes {};
+    std::array<float, frameSize / 2> outputMagnitudes {};
+    std::array<float, frameSize / 2> unusedMagnitudes {};
+};
 
 class ChoroborosAudioProcessor::AnalyzerWorker final : public juce::Thread
 {
@@ -813,10 +883,11 @@ public:
             if (flags.analyzersEnabled.load(std::memory_order_relaxed) && anyDemand)
                 owner.runAnalyzerPass();
 
+            // Park until demand returns; acquireAnalyzerCardDemand() notifies us.
             const int hz = owner.getAnalyzerRefreshHz();
             const int sleepMs = anyDemand
                 ? juce::jmax(8, 1000 / juce::jlimit(5, 60, hz))
-                : 120;
+                : -1;
             wait(sleepMs);
         }
     }
@@ -884,6 +955,10 @@ ChoroborosAudioProcessor::ChoroborosAudioProcessor()
     parameters.addParameterListener(HQ_ID, this);
     parameters.addParameterListener(MIX_ID, this);
     lastEngineIndex = getCurrentEngineColorIndex();
+    chorusDSP->setWetTap(&ChoroborosAudioProcessor::pushWetTap, this);
+    for (const auto* paramId : { RATE_ID, DEPTH_ID, OFFSET_ID, WIDTH_ID, COLOR_ID, MIX_ID })
+        rampRanges[static_cast<size_t>(rampTargetForParameter(paramId))] = parameters.getParameterRange(paramId);
+    analyzerHistory = std::make_unique<AnalyzerHistory>();
     analyzerWorker = std::make_unique<AnalyzerWorker>(*this);
 
     logLoadTraceEvent("processor_ctor_total_ms",
@@ -912,11 +987,57 @@ juce::File ChoroborosAudioProcessor::getLoadTraceLogFile()
         .getChildFile("load_trace.ndjson");
 }
 
+juce::File ChoroborosAudioProcessor::getProcessTimeHistogramFile()
+{
+    return getLoadTraceLogFile().getSiblingFile("block_latency.ndjson");
+}
+
+bool ChoroborosAudioProcessor::exportProcessTimeHistogram() const
+{
+    const auto summary = processTimeHistogram.summarise();
+    juce::var payload(new juce::DynamicObject());
+    auto* object = payload.getDynamicObject();
+    if (object == nullptr)
+        return false;
+
+    object->setProperty("tsUtc", juce::Time::getCurrentTime().toISO8601(true));
+    object->setProperty("instanceId", static_cast<juce::int64>(instanceId));
+    object->setProperty("sampleRate", getSampleRate());
+    object->setProperty("blockSize", getBlockSize());
+    object->setProperty("blocks", static_cast<juce::int64>(summary.blocks));
+    object->setProperty("deadlineMisses", static_cast<juce::int64>(summary.deadlineMisses));
+    object->setProperty("deadlineMissFraction", summary.deadlineMissFraction);
+    object->setProperty("p50Ms", summary.p50Ms);
+    object->setProperty("p90Ms", summary.p90Ms);
+    object->setProperty("p99Ms", summary.p99Ms);
+    object->setProperty("p999Ms", summary.p999Ms);
+
+    // Sparse [upperEdgeMs, count] pairs keep the line short.
+    juce::Array<juce::var> buckets;
+    for (int i = 0; i < choroboros::LatencyHistogram::kNumBuckets; ++i)
+    {
+        const auto count = processTimeHistogram.getBucketCount(i);
+        if (count == 0)
+            continue;
+        juce::Array<juce::var> pair;
+        pair.add(choroboros::LatencyHistogram::bucketUpperMs(i));
+        pair.add(static_cast<juce::int64>(count));
+        buckets.add(juce::var(pair));
+    }
+    object->setProperty("buckets", juce::var(buckets));
+
+    const auto file = getProcessTimeHistogramFile();
+    if (!file.getParentDirectory().createDirectory())
+        return false;
+    return file.appendText(juce::JSON::toString(payload, true) + "\n", false, false, nullptr);
+}
+
 void ChoroborosAudioProcessor::logLoadTraceEvent(const juce::String& eventName,
                                                  double elapsedMs,
                                                  const juce::String& notes) const
 {
-    appendLoadTraceLine(*this, eventName, elapsedMs, notes);
+    // Queued for the shared background writer; never touches disk on the caller's thread.
+    loadTraceWriter->enqueue(eventName, elapsedMs, instanceId, notes);
 }
 
 //==============================================================================
@@ -1170,21 +1291,24 @@ void ChoroborosAudioProcessor::prepareToPlay (double sampleRate, int samplesPerB
     spec.maximumBlockSize = juce::jmax(static_cast<juce::uint32>(samplesPerBlock), safetyMaxBlock);
     spec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
     
+    chorusDSP->setChannelPairs(ChorusDSP::channelPairsForLayout(getChannelLayoutOfBus(false, 0)));
     chorusDSP->prepare(spec);
-    constexpr int diagnosticBufferCeiling = 8192;
-    const int diagnosticBufferSize = juce::jmax<int>(samplesPerBlock, diagnosticBufferCeiling);
-    dryTapBuffer.setSize(2, diagnosticBufferSize, false, true, true);
-    wetEstimateBuffer.setSize(2, diagnosticBufferSize, false, true, true);
-    inputTapRing.clear();
-    wetTapRing.clear();
-    outputTapRing.clear();
+    chorusDSP->setNonRealtime(isNonRealtime());
+    qualityGovernor.reset();
+    chorusDSP->setQualityGovernorLevel(0);
+    liveTelemetry.governorLevel.store(0, std::memory_order_relaxed);
+    liveTelemetry.governorLoadRatio.store(0.0f, std::memory_order_relaxed);
+    analyzerTapRing.clear();
     activeAnalyzerSnapshotIndex.store(0, std::memory_order_relaxed);
     analyzerSnapshots[0] = {};
     analyzerSnapshots[1] = {};
     analyzerSequenceCounter.store(0, std::memory_order_relaxed);
 
-    if (analyzerWorker != nullptr && !analyzerWorker->isThreadRunning())
-        analyzerWorker->startThread(juce::Thread::Priority::low);
+    {
+        const juce::ScopedLock demandLock(analyzerDemandLock);
+        analyzerPlaybackPrepared = true;
+        updateAnalyzerWorkerStateLocked();
+    }
 
     startTimerHz(10);  // Apply runtime tuning on message thread, 10 Hz
 }
@@ -1192,13 +1316,26 @@ void ChoroborosAudioProcessor::prepareToPlay (double sampleRate, int samplesPerB
 void ChoroborosAudioProcessor::releaseResources()
 {
     stopTimer();
-    if (analyzerWorker != nullptr)
-        analyzerWorker->stopThread(1500);
+    {
+        const juce::ScopedLock demandLock(analyzerDemandLock);
+        analyzerPlaybackPrepared = false;
+        updateAnalyzerWorkerStateLocked();
+    }
     chorusDSP->reset();
 }
 
+void ChoroborosAudioProcessor::setNonRealtime (bool isNonRealtime) noexcept
+{
+    juce::AudioProcessor::setNonRealtime(isNonRealtime);
+    const juce::ScopedLock lock(dspLock);
+    if (chorusDSP != nullptr)
+        chorusDSP->setNonRealtime(isNonRealtime);
+}
+
 void ChoroborosAudioProcessor::timerCallback()
 {
+    flushGovernorTransitions();
+
     if (dspLock.tryEnter())
     {
         if (chorusDSP)
@@ -1214,8 +1351,13 @@ bool ChoroborosAudioProcessor::isBusesLayoutSupported (const BusesLayout& layout
     juce::ignoreUnused (layouts);
     return true;
   #else
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // Surround and immersive beds run in one instance (see ChorusDSP::setChannelPairs).
+    const auto& mainOutput = layouts.getMainOutputChannelSet();
+    if (mainOutput != juce::AudioChannelSet::mono()
+     && mainOutput != juce::AudioChannelSet::stereo()
+     && mainOutput != juce::AudioChannelSet::create5point1()
+     && mainOutput != juce::AudioChannelSet::create7point1()
+     && mainOutput != juce::AudioChannelSet::create7point1point4())
         return false;
 
     #if ! JucePlugin_IsSynth
@@ -1234,9 +1376,13 @@ void ChoroborosAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, j
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
     const int numSamples = buffer.getNumSamples();
-    const int tapSamples = juce::jmin(numSamples, dryTapBuffer.getNumSamples());
+    const int tapSamples = juce::jmin(numSamples, static_cast<int>(AnalyzerTapRing::capacity));
     const bool analyzerEnabled = diagnosticFeatureFlags.analyzersEnabled.load(std::memory_order_relaxed);
+    // Realtime only: offline renders have no deadline to protect.
+    const bool governorActive = qualityGovernorEnabled.load(std::memory_order_relaxed) && !isNonRealtime();
+    const int governorLevel = governorActive ? static_cast<int>(qualityGovernor.getLevel()) : 0;
     const bool needAnalyzerAudioTaps = analyzerEnabled
+        && governorLevel < static_cast<int>(choroboros::QualityGovernor::Level::analyzerTapsOff)
         && (diagnosticFeatureFlags.spectrumCardEnabled.load(std::memory_order_relaxed)
             || diagnosticFeatureFlags.transferCardEnabled.load(std::memory_order_relaxed)
             || diagnosticFeatureFlags.telemetryCardEnabled.load(std::memory_order_relaxed));
@@ -1244,20 +1390,16 @@ void ChoroborosAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, j
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
 
-    if (needAnalyzerAudioTaps && tapSamples > 0)
+    const bool writeAnalyzerTaps = needAnalyzerAudioTaps && tapSamples > 0;
+    if (writeAnalyzerTaps)
     {
         const float* inL = (totalNumInputChannels > 0) ? buffer.getReadPointer(0) : nullptr;
         const float* inR = (totalNumInputChannels > 1) ? buffer.getReadPointer(1) : inL;
-        auto* dryL = dryTapBuffer.getWritePointer(0);
-        auto* dryR = dryTapBuffer.getWritePointer(1);
-        for (int i = 0; i < tapSamples; ++i)
-        {
-            const float sampleL = (inL != nullptr) ? inL[i] : 0.0f;
-            const float sampleR = (inR != nullptr) ? inR[i] : sampleL;
-            dryL[i] = sampleL;
-            dryR[i] = sampleR;
-        }
-        inputTapRing.push(dryL, dryR, tapSamples);
+        analyzerTapRing.beginWrite(tapSamples);
+        analyzerTapRing.writeLane(AnalyzerTapRing::inputLeft, inL, tapSamples);
+        analyzerTapRing.writeLane(AnalyzerTapRing::inputRight, inR, tapSamples);
+        wetTapSamplesWritten = 0;
+        pendingTapSamples = tapSamples;
     }
 
     const float inputPeakL = (totalNumInputChannels > 0) ? buffer.getMagnitude(0, 0, numSamples) : 0.0f;
@@ -1265,11 +1407,28 @@ void ChoroborosAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, j
 
     const auto startTicks = juce::Time::getHighResolutionTicks();
     updateDSPParameters();
+    parameterRamps.drain();
 
     {
         juce::ScopedLock sl(dspLock);
+        chorusDSP->setQualityGovernorLevel(governorLevel);
         juce::dsp::AudioBlock<float> block(buffer);
-        chorusDSP->process(block);
+        if (!parameterRamps.anyActive())
+        {
+            chorusDSP->setWetTapEnabled(writeAnalyzerTaps);
+            chorusDSP->process(block);
+        }
+        else
+        {
+            // Each sub-block's wet tap lands at its own offset in the reserved ring block.
+            chorusDSP->setWetTapEnabled(writeAnalyzerTaps);
+            for (int start = 0; start < numSamples; start += parameterRampSubBlock)
+            {
+                const int length = juce::jmin(parameterRampSubBlock, numSamples - start);
+                applyParameterRamps(length);
+                chorusDSP->process(block.getSubBlock(static_cast<size_t>(start), static_cast<size_t>(length)));
+            }
+        }
     }
 
     const auto elapsedTicks = juce::Time::getHighResolutionTicks() - startTicks;
@@ -1277,37 +1436,20 @@ void ChoroborosAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, j
     const float outputPeakL = (totalNumOutputChannels > 0) ? buffer.getMagnitude(0, 0, numSamples) : 0.0f;
     const float outputPeakR = (totalNumOutputChannels > 1) ? buffer.getMagnitude(1, 0, numSamples) : outputPeakL;
 
-    if (needAnalyzerAudioTaps && tapSamples > 0)
+    if (writeAnalyzerTaps)
     {
         const float* outL = (totalNumOutputChannels > 0) ? buffer.getReadPointer(0) : nullptr;
         const float* outR = (totalNumOutputChannels > 1) ? buffer.getReadPointer(1) : outL;
-        outputTapRing.push(outL, outR, tapSamples);
-
-        float mixMapped = 0.5f;
-        if (const auto* mixParam = parameters.getRawParameterValue(MIX_ID))
-            mixMapped = juce::jlimit(0.0f, 1.0f, mapParameterValue(MIX_ID, mixParam->load()));
-
-        auto* wetL = wetEstimateBuffer.getWritePointer(0);
-        auto* wetR = wetEstimateBuffer.getWritePointer(1);
-        const float* dryL = dryTapBuffer.getReadPointer(0);
-        const float* dryR = dryTapBuffer.getReadPointer(1);
-        const float invMix = (mixMapped > 1.0e-5f) ? (1.0f / mixMapped) : 0.0f;
-        const float dryScale = 1.0f - mixMapped;
-        for (int i = 0; i < tapSamples; ++i)
+        if (wetTapSamplesWritten < tapSamples)
         {
-            if (mixMapped <= 1.0e-5f)
-            {
-                wetL[i] = 0.0f;
-                wetR[i] = 0.0f;
-                continue;
-            }
-
-            const float outSampleL = (outL != nullptr) ? outL[i] : 0.0f;
-            const float outSampleR = (outR != nullptr) ? outR[i] : outSampleL;
-            wetL[i] = juce::jlimit(-2.0f, 2.0f, (outSampleL - dryL[i] * dryScale) * invMix);
-            wetR[i] = juce::jlimit(-2.0f, 2.0f, (outSampleR - dryR[i] * dryScale) * invMix);
+            const int missing = tapSamples - wetTapSamplesWritten;
+            analyzerTapRing.writeLane(AnalyzerTapRing::wetLeft, nullptr, missing, wetTapSamplesWritten);
+            analyzerTapRing.writeLane(AnalyzerTapRing::wetRight, nullptr, missing, wetTapSamplesWritten);
         }
-        wetTapRing.push(wetL, wetR, tapSamples);
+        analyzerTapRing.writeLane(AnalyzerTapRing::outputLeft, outL, tapSamples);
+        analyzerTapRing.writeLane(AnalyzerTapRing::outputRight, outR, tapSamples);
+        analyzerTapRing.endWrite(tapSamples);
+        pendingTapSamples = 0;
     }
 
     auto updatePeakHold = [](std::atomic<float>& target, float measured)
@@ -1330,6 +1472,157 @@ void ChoroborosAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, j
     }
 
     liveTelemetry.processBlockCount.fetch_add(1, std::memory_order_relaxed);
+
+    const double processSeconds = juce::Time::highResolutionTicksToSeconds(elapsedTicks);
+    const double sampleRate = getSampleRate();
+    const double deadlineSeconds = (!isNonRealtime() && sampleRate > 0.0) ? numSamples / sampleRate : 0.0;
+    processTimeHistogram.record(processSeconds, deadlineSeconds);
+
+    if (governorActive)
+    {
+        choroboros::QualityGovernor::Transition transition;
+        if (qualityGovernor.update(processSeconds, numSamples, sampleRate, transition))
+            publishGovernorTransition(transition);
+        liveTelemetry.governorLoadRatio.store(qualityGovernor.getSmoothedLoad(), std::memory_order_relaxed);
+    }
+    else if (qualityGovernor.getLevel() != choroboros::QualityGovernor::Level::full)
+    {
+        choroboros::QualityGovernor::Transition transition;
+        transition.from = qualityGovernor.getLevel();
+        transition.to = choroboros::QualityGovernor::Level::full;
+        transition.loadRatio = qualityGovernor.getSmoothedLoad();
+        qualityGovernor.reset();
+        publishGovernorTransition(transition);
+    }
+}
+
+void ChoroborosAudioProcessor::pushWetTap(void* context, const float* left, const float* right, int numSamples)
+{
+    // Called from ChorusDSPProcess::processChorus with the wet block just before dry/wet mixing,
+    // once per process() call, so ramped blocks deliver it one sub-block at a time. Each call
+    // continues where the last one stopped in the block reserved by processBlock; the shared
+    // index is published after the output tap.
+    auto* self = static_cast<ChoroborosAudioProcessor*>(context);
+    const int offset = self->wetTapSamplesWritten;
+    const int samples = juce::jmin(numSamples, self->pendingTapSamples - offset);
+    if (samples <= 0)
+        return;
+    self->analyzerTapRing.writeLane(AnalyzerTapRing::wetLeft, left, samples, offset);
+    self->analyzerTapRing.writeLane(AnalyzerTapRing::wetRight, right != nullptr ? right : left, samples, offset);
+    self->wetTapSamplesWritten = offset + samples;
+}
+
+void ChoroborosAudioProcessor::publishGovernorTransition(const choroboros::QualityGovernor::Transition& transition)
+{
+    liveTelemetry.governorLevel.store(static_cast<int>(transition.to), std::memory_order_relaxed);
+    if (static_cast<int>(transition.to) > static_cast<int>(transition.from))
+        liveTelemetry.governorStepDownCount.fetch_add(1, std::memory_order_relaxed);
+    else
+        liveTelemetry.governorStepUpCount.fetch_add(1, std::memory_order_relaxed);
+
+    // Dropped if the timer has fallen 32 transitions behind; the counters above stay exact.
+    const auto scope = governorTransitionFifo.write(1);
+    if (scope.blockSize1 > 0)
+        governorTransitionQueue[static_cast<size_t>(scope.startIndex1)] = transition;
+}
+
+void ChoroborosAudioProcessor::flushGovernorTransitions()
+{
+    for (;;)
+    {
+        choroboros::QualityGovernor::Transition transition;
+        {
+            const auto scope = governorTransitionFifo.read(1);
+            if (scope.blockSize1 <= 0)
+                break;
+            transition = governorTransitionQueue[static_cast<size_t>(scope.startIndex1)];
+        }
+
+        logLoadTraceEvent("governor_transition",
+                          0.0,
+                          "from=" + juce::String(choroboros::QualityGovernor::levelToToken(transition.from))
+                              + ",to=" + juce::String(choroboros::QualityGovernor::levelToToken(transition.to))
+                              + ",load=" + juce::String(transition.loadRatio, 3));
+    }
+}
+
+void ChoroborosAudioProcessor::setQualityGovernorEnabled(bool shouldEnable)
+{
+    qualityGovernorEnabled.store(shouldEnable, std::memory_order_relaxed);
+}
+
+bool ChoroborosAudioProcessor::isQualityGovernorEnabled() const
+{
+    return qualityGovernorEnabled.load(std::memory_order_relaxed);
+}
+
+int ChoroborosAudioProcessor::rampTargetForParameter(const juce::String& paramId)
+{
+    if (paramId == RATE_ID) return rampRate;
+    if (paramId == DEPTH_ID) return rampDepth;
+    if (paramId == OFFSET_ID) return rampOffset;
+    if (paramId == WIDTH_ID) return rampWidth;
+    if (paramId == COLOR_ID) return rampColor;
+    if (paramId == MIX_ID) return rampMix;
+    return -1;
+}
+
+bool ChoroborosAudioProcessor::supportsParameterRamp(const juce::String& paramId)
+{
+    return rampTargetForParameter(paramId) >= 0;
+}
+
+bool ChoroborosAudioProcessor::queueParameterRamp(const juce::String& paramId,
+                                                  float startNormalised,
+                                                  float endNormalised,
+                                                  double durationMs)
+{
+    const int target = rampTargetForParameter(paramId);
+    if (target < 0)
+        return false;
+
+    const double sampleRate = getSampleRate() > 0.0 ? getSampleRate() : 48000.0;
+    decltype(parameterRamps)::Segment segment;
+    segment.target = target;
+    segment.startValue = juce::jlimit(0.0f, 1.0f, startNormalised);
+    segment.endValue = juce::jlimit(0.0f, 1.0f, endNormalised);
+    segment.lengthSamples = juce::jmax<std::int64_t>(1, static_cast<std::int64_t>(std::llround(durationMs * 0.001 * sampleRate)));
+    return parameterRamps.push(segment);
+}
+
+void ChoroborosAudioProcessor::stopParameterRamps(const juce::String& paramId)
+{
+    if (paramId.isEmpty())
+    {
+        parameterRamps.stop(decltype(parameterRamps)::kAllTargets);
+        return;
+    }
+    const int target = rampTargetForParameter(paramId);
+    if (target >= 0)
+        parameterRamps.stop(target);
+}
+
+void ChoroborosAudioProcessor::applyParameterRamps(int numSamples)
+{
+    // Overrides what updateDSPParameters() set for this block; the value lands at the sub-block end.
+    for (int target = 0; target < numRampTargets; ++target)
+    {
+        if (!parameterRamps.isActive(target))
+            continue;
+
+        const float raw = rampRanges[static_cast<size_t>(target)].convertFrom0to1(parameterRamps.valueAfter(target, numSamples));
+        switch (target)
+        {
+            case rampRate: chorusDSP->setRate(mapTunedValue(raw, RATE_MIN, RATE_MAX, tuning.rate)); break;
+            case rampDepth: chorusDSP->setDepth(mapTunedValue(raw, DEPTH_MIN, DEPTH_MAX, tuning.depth)); break;
+            case rampOffset: chorusDSP->setOffset(mapTunedValue(raw, OFFSET_MIN, OFFSET_MAX, tuning.offset)); break;
+            case rampWidth: chorusDSP->setWidth(mapTunedValue(raw, WIDTH_MIN, WIDTH_MAX, tuning.width)); break;
+            case rampColor: chorusDSP->setColor(mapTunedValue(raw, COLOR_MIN, COLOR_MAX, tuning.color)); break;
+            case rampMix: chorusDSP->setMix(mapTunedValue(raw, MIX_MIN, MIX_MAX, tuning.mix)); break;
+            default: break;
+        }
+    }
+    parameterRamps.advance(numSamples);
 }
 
 void ChoroborosAudioProcessor::initTuningDefaults()
@@ -1588,68 +1881,35 @@ juce::AudioProcessorEditor* ChoroborosAudioProcessor::createEditor()
 //==============================================================================
 void ChoroborosAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
-    auto state = parameters.copyState();
-    state.setProperty("modularCoresEnabled", modularCoresEnabled, nullptr);
-    state.setProperty("coreAssignmentsJson", encodeCoreAssignmentsForStateProperty(coreAssignments), nullptr);
-    std::unique_ptr<juce::XmlElement> xml (state.createXml());
-    copyXmlToBinary (*xml, destData);
+    PluginStateCodec chunk;
+    for (size_t i = 0; i < binaryStateParameterOrder.size(); ++i)
+    {
+        if (auto* value = parameters.getRawParameterValue(binaryStateParameterOrder[i]))
+            chunk.parameterValues[i] = value->load();
+    }
+    chunk.modularCoresEnabled = modularCoresEnabled;
+    chunk.coreAssignments = coreAssignments;
+
+    const auto bytes = chunk.encode();
+    destData.replaceAll(bytes.data(), bytes.size());
 }
 
 void ChoroborosAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
 {
     const double stateLoadStartMs = juce::Time::getMillisecondCounterHiRes();
-    bool stateApplied = false;
-    std::unique_ptr<juce::XmlElement> xmlState (getXmlFromBinary (data, sizeInBytes));
-
-    if (xmlState.get() != nullptr)
-    {
-        if (xmlState->hasTagName (parameters.state.getType()))
-        {
-            stateLoadInProgress = true;
-            parameters.replaceState (juce::ValueTree::fromXml (*xmlState));
-            if (auto* p = parameters.getRawParameterValue(ENGINE_COLOR_ID))
-                lastEngineIndex = juce::jlimit(0, 4, static_cast<int>(p->load()));
-
-            bool restoredModular = false;
-            if (parameters.state.hasProperty("modularCoresEnabled"))
-            {
-                const auto value = parameters.state.getProperty("modularCoresEnabled");
-                if (value.isBool())
-                    restoredModular = static_cast<bool>(value);
-                else if (value.isInt() || value.isInt64() || value.isDouble())
-                    restoredModular = static_cast<double>(value) >= 0.5;
-                else
-                    restoredModular = value.toString().equalsIgnoreCase("true") || value.toString() == "1";
-            }
-            setModularCoresEnabled(restoredModular);
-
-            choroboros::CoreAssignmentTable restoredAssignments;
-            restoredAssignments.resetToLegacy();
-            bool loadedAssignments = false;
-            if (parameters.state.hasProperty("coreAssignmentsJson"))
-            {
-                loadedAssignments = decodeCoreAssignmentsFromStateProperty(
-                    parameters.state.getProperty("coreAssignmentsJson").toString(),
-                    restoredAssignments);
-            }
-            if (parameters.state.hasProperty("coreAssignments"))
-            {
-                loadedAssignments = parseCoreAssignmentsFromVar(
-                    parameters.state.getProperty("coreAssignments"),
-                    restoredAssignments) || loadedAssignments;
-            }
-            if (!loadedAssignments)
-                restoredAssignments.resetToLegacy();
-            setCoreAssignments(restoredAssignments);
+    PluginStateCodec chunk;
+    const auto decodeResult = PluginStateCodec::decode(data, static_cast<size_t>(juce::jmax(0, sizeInBytes)), chunk);
 
-            stateLoadInProgress = false;
-            stateApplied = true;
-        }
-    }
+    bool stateApplied = false;
+    if (decodeResult == PluginStateCodec::DecodeResult::ok)
+        stateApplied = applyBinaryState(chunk);
+    else if (decodeResult == PluginStateCodec::DecodeResult::notBinary)
+        stateApplied = applyLegacyXmlState(data, sizeInBytes);
 
     logLoadTraceEvent("processor_set_state_information_ms",
                       juce::Time::getMillisecondCounterHiRes() - stateLoadStartMs,
                       juce::String("bytes=") + juce::String(sizeInBytes)
+                          + ",format=" + stateDecodeResultToToken(decodeResult)
                           + ",applied=" + (stateApplied ? "1" : "0"));
     if (stateApplied)
     {
@@ -1659,8 +1919,76 @@ void ChoroborosAudioProcessor::setStateInformation (const void* data, int sizeIn
     }
 }
 
+bool ChoroborosAudioProcessor::applyBinaryState(const PluginStateCodec& chunk)
+{
+    stateLoadInProgress = true;
+    for (size_t i = 0; i < binaryStateParameterOrder.size(); ++i)
+    {
+        if (auto* param = parameters.getParameter(binaryStateParameterOrder[i]))
+            param->setValueNotifyingHost(param->convertTo0to1(chunk.parameterValues[i]));
+    }
+    if (auto* p = parameters.getRawParameterValue(ENGINE_COLOR_ID))
+        lastEngineIndex = juce::jlimit(0, 4, static_cast<int>(p->load()));
+
+    setModularCoresEnabled(chunk.modularCoresEnabled);
+    setCoreAssignments(chunk.coreAssignments);
+    stateLoadInProgress = false;
+    return true;
+}
+
+// Read-only path for sessions saved before the binary chunk (XML ValueTree, JSON core assignments).
+bool ChoroborosAudioProcessor::applyLegacyXmlState(const void* data, int sizeInBytes)
+{
+    std::unique_ptr<juce::XmlElement> xmlState (getXmlFromBinary (data, sizeInBytes));
+    if (xmlState == nullptr || !xmlState->hasTagName (parameters.state.getType()))
+        return false;
+
+    stateLoadInProgress = true;
+    parameters.replaceState (juce::ValueTree::fromXml (*xmlState));
+    if (auto* p = parameters.getRawParameterValue(ENGINE_COLOR_ID))
+        lastEngineIndex = juce::jlimit(0, 4, static_cast<int>(p->load()));
+
+    bool restoredModular = false;
+    if (parameters.state.hasProperty("modularCoresEnabled"))
+    {
+        const auto value = parameters.state.getProperty("modularCoresEnabled");
+        if (value.isBool())
+            restoredModular = static_cast<bool>(value);
+        else if (value.isInt() || value.isInt64() || value.isDouble())
+            restoredModular = static_cast<double>(value) >= 0.5;
+        else
+            restoredModular = value.toString().equalsIgnoreCase("true") || value.toString() == "1";
+    }
+    setModularCoresEnabled(restoredModular);
+
+    choroboros::CoreAssignmentTable restoredAssignments;
+    restoredAssignments.resetToLegacy();
+    bool loadedAssignments = false;
+    if (parameters.state.hasProperty("coreAssignmentsJson"))
+    {
+        loadedAssignments = decodeCoreAssignmentsFromStateProperty(
+            parameters.state.getProperty("coreAssignmentsJson").toString(),
+            restoredAssignments);
+    }
+    if (parameters.state.hasProperty("coreAssignments"))
+    {
+        loadedAssignments = parseCoreAssignmentsFromVar(
+            parameters.state.getProperty("coreAssignments"),
+            restoredAssignments) || loadedAssignments;
+    }
+    if (!loadedAssignments)
+        restoredAssignments.resetToLegacy();
+    setCoreAssignments(restoredAssignments);
+
+    stateLoadInProgress = false;
+    return true;
+}
+
 void ChoroborosAudioProcessor::parameterChanged(const juce::String& parameterID, float newValue)
 {
+    if (!rampEndWriteInProgress.load())
+        parameterRamps.cancel(rampTargetForParameter(parameterID));
+
     if (presetLoadInProgress || stateLoadInProgress || engineProfileApplyInProgress)
     {
         if (parameterID == ENGINE_COLOR_ID)
@@ -1795,13 +2123,55 @@ int ChoroborosAudioProcessor::getAnalyzerRefreshHz() const
     return juce::jlimit(5, 60, analyzerRuntimeConfig.refreshHz.load(std::memory_order_relaxed));
 }
 
-void ChoroborosAudioProcessor::setAnalyzerCardDemand(bool modulationVisible, bool spectrumVisible,
-                                                     bool transferVisible, bool telemetryVisible)
+void ChoroborosAudioProcessor::acquireAnalyzerCardDemand(bool modulation, bool spectrum, bool transfer, bool telemetry)
+{
+    changeAnalyzerCardDemand(modulation, spectrum, transfer, telemetry, 1);
+}
+
+void ChoroborosAudioProcessor::releaseAnalyzerCardDemand(bool modulation, bool spectrum, bool transfer, bool telemetry)
 {
-    diagnosticFeatureFlags.modulationCardEnabled.store(modulationVisible, std::memory_order_relaxed);
-    diagnosticFeatureFlags.spectrumCardEnabled.store(spectrumVisible, std::memory_order_relaxed);
-    diagnosticFeatureFlags.transferCardEnabled.store(transferVisible, std::memory_order_relaxed);
-    diagnosticFeatureFlags.telemetryCardEnabled.store(telemetryVisible, std::memory_order_relaxed);
+    changeAnalyzerCardDemand(modulation, spectrum, transfer, telemetry, -1);
+}
+
+void ChoroborosAudioProcessor::changeAnalyzerCardDemand(bool modulation, bool spectrum, bool transfer, bool telemetry, int delta)
+{
+    const juce::ScopedLock demandLock(analyzerDemandLock);
+    const std::array<bool, 4> cards { { modulation, spectrum, transfer, telemetry } };
+    for (size_t i = 0; i < cards.size(); ++i)
+    {
+        if (cards[i])
+        {
+            jassert(analyzerCardDemandCounts[i] + delta >= 0); // release without matching acquire
+            analyzerCardDemandCounts[i] = juce::jmax(0, analyzerCardDemandCounts[i] + delta);
+        }
+    }
+
+    diagnosticFeatureFlags.modulationCardEnabled.store(analyzerCardDemandCounts[0] > 0, std::memory_order_relaxed);
+    diagnosticFeatureFlags.spectrumCardEnabled.store(analyzerCardDemandCounts[1] > 0, std::memory_order_relaxed);
+    diagnosticFeatureFlags.transferCardEnabled.store(analyzerCardDemandCounts[2] > 0, std::memory_order_relaxed);
+    diagnosticFeatureFlags.telemetryCardEnabled.store(analyzerCardDemandCounts[3] > 0, std::memory_order_relaxed);
+    updateAnalyzerWorkerStateLocked();
+}
+
+void ChoroborosAudioProcessor::updateAnalyzerWorkerStateLocked()
+{
+    if (analyzerWorker == nullptr)
+        return;
+
+    const bool anyDemand = std::any_of(analyzerCardDemandCounts.begin(), analyzerCardDemandCounts.end(),
+                                       [](int count) { return count > 0; });
+    if (!analyzerPlaybackPrepared)
+    {
+        if (analyzerWorker->isThreadRunning())
+            analyzerWorker->stopThread(1500);
+        return;
+    }
+
+    // Started lazily on first demand; afterwards it parks while idle rather than being torn down.
+    if (anyDemand && !analyzerWorker->isThreadRunning())
+        analyzerWorker->startThread(juce::Thread::Priority::low);
+    else
+        analyzerWorker->notify();
 }
 
 void ChoroborosAudioProcessor::runAnalyzerPass()
@@ -1822,43 +2192,32 @@ void ChoroborosAudioProcessor::runAnalyzerPass()
     if (!(needModulation || needSpectrum || needTransfer || needTelemetry))
         return;
 
-    static thread_local juce::dsp::FFT fft(ANALYZER_FFT_ORDER);
-    static thread_local juce::dsp::WindowingFunction<float> window(fftSize, juce::dsp::WindowingFunction<float>::hann, true);
-    static thread_local std::array<float, fftSize * 2> fftData {};
-
+    auto& history = *analyzerHistory;
     const int currentFront = activeAnalyzerSnapshotIndex.load(std::memory_order_acquire);
     const AnalyzerSnapshot previous = analyzerSnapshots[juce::jlimit(0, 1, currentFront)];
     const bool peakHoldEnabled = analyzerRuntimeConfig.peakHold.load(std::memory_order_relaxed);
     const bool needAudioTaps = needSpectrum || needTransfer || needTelemetry;
 
-    std::array<float, fftSize> inputL {};
-    std::array<float, fftSize> inputR {};
-    std::array<float, fftSize> wetL {};
-    std::array<float, fftSize> wetR {};
-    std::array<float, fftSize> outputL {};
-    std::array<float, fftSize> outputR {};
-
     if (needAudioTaps)
     {
-        inputTapRing.copyLatest(inputL.data(), inputR.data(), fftSize);
-        wetTapRing.copyLatest(wetL.data(), wetR.data(), fftSize);
-        outputTapRing.copyLatest(outputL.data(), outputR.data(), fftSize);
+        history.samplesSinceSpectrum = juce::jmin(AnalyzerHistory::frameSize,
+                                                  history.samplesSinceSpectrum + history.pull(analyzerTapRing));
     }
 
-    auto computeSpectrum = [&](const std::array<float, fftSize>& left,
-                               const std::array<float, fftSize>& right,
-                               std::array<float, bins>& destination,
-                               const std::array<float, bins>& previousSpectrum)
-    {
-        for (int i = 0; i < fftSize; ++i)
-            fftData[static_cast<size_t>(i)] = 0.5f * (left[static_cast<size_t>(i)] + right[static_cast<size_t>(i)]);
-        std::fill(fftData.begin() + fftSize, fftData.end(), 0.0f);
-        window.multiplyWithWindowingTable(fftData.data(), fftSize);
-        fft.performFrequencyOnlyForwardTransform(fftData.data());
+    const auto& inputL = history.input.left;
+    const auto& inputR = history.input.right;
+    const auto& wetL = history.wet.left;
+    const auto& wetR = history.wet.right;
+    const auto& outputL = history.output.left;
+    const auto& outputR = history.output.right;
 
+    auto normaliseSpectrum = [&](const std::array<float, bins>& magnitudes,
+                                 std::array<float, bins>& destination,
+                                 const std::array<float, bins>& previousSpectrum)
+    {
         for (int i = 0; i < bins; ++i)
         {
-            const float gain = juce::jmax(1.0e-7f, fftData[static_cast<size_t>(i)] / static_cast<float>(fftSize));
+            const float gain = juce::jmax(1.0e-7f, magnitudes[static_cast<size_t>(i)] / static_cast<float>(fftSize));
             const float db = juce::Decibels::gainToDecibels(gain, -100.0f);
             float normalized = juce::jlimit(0.0f, 1.0f, (db + 100.0f) * 0.01f);
             if (peakHoldEnabled && previous.valid)
@@ -1904,11 +2263,15 @@ void ChoroborosAudioProcessor::runAnalyzerPass()
         fillWaveform(outputL, outputR, snapshot.outputWaveform);
     }
 
-    if (needSpectrum)
+    // Advance the STFT once per hop of new audio; in between the previous spectra are kept.
+    if (needSpectrum && history.samplesSinceSpectrum >= AnalyzerHistory::hopSize)
     {
-        computeSpectrum(inputL, inputR, snapshot.inputSpectrum, previous.inputSpectrum);
-        computeSpectrum(wetL, wetR, snapshot.wetSpectrum, previous.wetSpectrum);
-        computeSpectrum(outputL, outputR, snapshot.outputSpectrum, previous.outputSpectrum);
+        history.samplesSinceSpectrum = 0;
+        history.computePairMagnitudes(history.input, &history.wet, history.inputMagnitudes, history.wetMagnitudes);
+        history.computePairMagnitudes(history.output, nullptr, history.outputMagnitudes, history.unusedMagnitudes);
+        normaliseSpectrum(history.inputMagnitudes, snapshot.inputSpectrum, previous.inputSpectrum);
+        normaliseSpectrum(history.wetMagnitudes, snapshot.wetSpectrum, previous.wetSpectrum);
+        normaliseSpectrum(history.outputMagnitudes, snapshot.outputSpectrum, previous.outputSpectrum);
     }
 
     if (needTelemetry)
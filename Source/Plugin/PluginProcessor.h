@@ -24,7 +24,13 @@
 #include <cstdint>
 #include <vector>
 #include "../DSP/ChorusDSP.h"
+#include "../DSP/LatencyHistogram.h"
+#include "../DSP/ParameterRampQueue.h"
+#include "../DSP/QualityGovernor.h"
 #include "FeedbackCollector.h"
+#include "LoadTraceWriter.h"
+
+struct PluginStateCodec;
 
 //==============================================================================
 /**
@@ -64,6 +70,7 @@ public:
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void setNonRealtime (bool isNonRealtime) noexcept override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -123,6 +130,8 @@ public:
     std::vector<choroboros::SlotAssignment> getDuplicateAssignmentWarnings() const;
     int getCurrentEngineColorIndex() const;
     bool isHqEnabled() const;
+    bool isCoreSwitchPending() const { return chorusDSP->isCoreSwitchPending(); }
+    int getNumWidthPairs() const { return chorusDSP->getNumWidthPairs(); }
     const std::array<EngineParamProfile, 5>& getEngineParamProfiles() const { return engineParamProfiles; }
     void loadEngineParamProfilesFromVar(const juce::var& profilesVar);
     void syncEngineInternalsToActiveDsp(int colorIndex, bool hqEnabled = false);
@@ -141,18 +150,34 @@ public:
         std::atomic<std::uint64_t> parameterWriteCount { 0 };
         std::atomic<std::uint64_t> engineSwitchCount { 0 };
         std::atomic<std::uint64_t> hqToggleCount { 0 };
+        std::atomic<int> governorLevel { 0 };             // choroboros::QualityGovernor::Level
+        std::atomic<float> governorLoadRatio { 0.0f };    // Smoothed process time / block deadline
+        std::atomic<std::uint64_t> governorStepDownCount { 0 };
+        std::atomic<std::uint64_t> governorStepUpCount { 0 };
     };
 
     const LiveTelemetry& getLiveTelemetry() const { return liveTelemetry; }
     void resetLiveTelemetryPeakHold();
 
+    // processBlock time distribution (recorded wait-free on the audio thread).
+    const choroboros::LatencyHistogram& getProcessTimeHistogram() const { return processTimeHistogram; }
+    void resetProcessTimeHistogram() { processTimeHistogram.reset(); }
+    void setDeadlineMissFraction(float fraction) { processTimeHistogram.setDeadlineMissFraction(fraction); }
+    // Appends one NDJSON line (summary + non-empty buckets) to getProcessTimeHistogramFile().
+    bool exportProcessTimeHistogram() const;
+    static juce::File getProcessTimeHistogramFile();
+    // Size of the per-instance DSP arena (delay lines, BBD stages, block buffers) from the last prepare.
+    size_t getDspArenaFootprintBytes() const { return chorusDSP->getArenaFootprintBytes(); }
+    bool isDspArenaHugePageBacked() const { return chorusDSP->isArenaHugePageBacked(); }
+
     struct DiagnosticFeatureFlags
     {
         std::atomic<bool> analyzersEnabled { true };
-        std::atomic<bool> spectrumCardEnabled { true };
-        std::atomic<bool> modulationCardEnabled { true };
-        std::atomic<bool> transferCardEnabled { true };
-        std::atomic<bool> telemetryCardEnabled { true };
+        // Card flags are derived from consumer demand (see acquireAnalyzerCardDemand).
+        std::atomic<bool> spectrumCardEnabled { false };
+        std::atomic<bool> modulationCardEnabled { false };
+        std::atomic<bool> transferCardEnabled { false };
+        std::atomic<bool> telemetryCardEnabled { false };
     };
 
     struct AnalyzerRuntimeConfig
@@ -195,9 +220,31 @@ public:
     bool isAnalyzerPeakHoldEnabled() const;
     void setAnalyzerRefreshHz(int hz);
     int getAnalyzerRefreshHz() const;
-    void setAnalyzerCardDemand(bool modulationVisible, bool spectrumVisible,
-                               bool transferVisible, bool telemetryVisible);
+    // Reference-counted across editors: each consumer acquires the cards it shows and releases
+    // them when hidden or destroyed. With no demand the audio thread skips every tap and the
+    // analyzer worker stays parked (it is only started once something asks for it).
+    void acquireAnalyzerCardDemand(bool modulation, bool spectrum, bool transfer, bool telemetry);
+    void releaseAnalyzerCardDemand(bool modulation, bool spectrum, bool transfer, bool telemetry);
     void resetToFactoryDefaults();
+    void setQualityGovernorEnabled(bool shouldEnable);
+    bool isQualityGovernorEnabled() const;
+    // Audio-thread ramps for the macro parameters (console sweeps, scripted `macro` moves).
+    // Values are normalised 0..1 and applied every parameterRampSubBlock samples, so the ramp
+    // follows the sample clock; the parameter itself should already hold the end value.
+    static constexpr int parameterRampSubBlock = 32;
+    static bool supportsParameterRamp(const juce::String& paramId);
+    bool queueParameterRamp(const juce::String& paramId, float startNormalised, float endNormalised, double durationMs);
+    // Empty id stops every ramp.
+    void stopParameterRamps(const juce::String& paramId = {});
+    // Any other change to a ramped parameter (knob, host automation, preset) stops its ramp, so
+    // wrap the write that lands a queued ramp's end value in one of these.
+    struct ScopedRampEndWrite
+    {
+        explicit ScopedRampEndWrite(ChoroborosAudioProcessor& owner) : flag(owner.rampEndWriteInProgress) { flag.store(true); }
+        ~ScopedRampEndWrite() { flag.store(false); }
+        std::atomic<bool>& flag;
+    };
+    int getNumActiveParameterRamps() const { return parameterRamps.getNumActive(); }
     void logLoadTraceEvent(const juce::String& eventName,
                            double elapsedMs,
                            const juce::String& notes = {}) const;
@@ -250,6 +297,8 @@ private:
     void persistActiveEngineInternalsFromDsp();
     void restoreEngineInternalsToDsp(int colorIndex, bool hqEnabled);
     void runAnalyzerPass();
+    bool applyBinaryState(const PluginStateCodec& chunk);
+    bool applyLegacyXmlState(const void* data, int sizeInBytes);
     
     juce::CriticalSection dspLock;
     std::unique_ptr<ChorusDSP> chorusDSP;
@@ -262,37 +311,88 @@ private:
     
     int currentProgram = 0; // Current preset index
     std::uint64_t instanceId = 0;
+    juce::SharedResourcePointer<LoadTraceWriter> loadTraceWriter;
     std::array<EngineParamProfile, 5> engineParamProfiles;
     int lastEngineIndex = 0;
     std::atomic<bool> presetLoadInProgress { false };
     std::atomic<bool> stateLoadInProgress { false };
     std::atomic<bool> engineProfileApplyInProgress { false };
+    std::atomic<bool> rampEndWriteInProgress { false };
     LiveTelemetry liveTelemetry;
+    choroboros::LatencyHistogram processTimeHistogram;
+
+    // CPU-budget governor (audio thread). Transitions are queued for the timer to write to the load trace.
+    // Off unless opted in (`governor on`): it changes the sound under load, so it must not be a surprise.
+    choroboros::QualityGovernor qualityGovernor;
+    std::atomic<bool> qualityGovernorEnabled { false };
+    static constexpr int governorTransitionQueueSize = 32;
+    juce::AbstractFifo governorTransitionFifo { governorTransitionQueueSize };
+    std::array<choroboros::QualityGovernor::Transition, governorTransitionQueueSize> governorTransitionQueue {};
+    void publishGovernorTransition(const choroboros::QualityGovernor::Transition& transition);
+    void flushGovernorTransitions();
+
+    enum RampTarget
+    {
+        rampRate = 0,
+        rampDepth,
+        rampOffset,
+        rampWidth,
+        rampColor,
+        rampMix,
+        numRampTargets
+    };
+    static int rampTargetForParameter(const juce::String& paramId);
+    void applyParameterRamps(int numSamples);
+    choroboros::ParameterRampQueue<numRampTargets> parameterRamps;
+    std::array<juce::NormalisableRange<float>, numRampTargets> rampRanges;
 
     class AnalyzerWorker;
-    struct StereoTapRingBuffer
+    // Single-producer/single-consumer ring carrying all analyzer taps as planar lanes that share
+    // one write index. The audio thread reserves a block (beginWrite), fills each lane with at
+    // most two memcpys, then publishes once. The reader copies ranges the same way and checks the
+    // reservation sequence afterwards to detect that the writer lapped it mid-copy (torn read).
+    // A lapped copy can hold a mix of old and new samples; copyRange() reports it and the reader
+    // throws the whole copy away, so torn data never reaches a display.
+    struct AnalyzerTapRing
     {
-        static constexpr std::uint32_t capacity = 1u << 16; // 65536 samples, power-of-two.
-        std::array<float, capacity> left {};
-        std::array<float, capacity> right {};
-        std::atomic<std::uint64_t> writeIndex { 0 };
+        enum Lane
+        {
+            inputLeft = 0, inputRight, wetLeft, wetRight, outputLeft, outputRight, numLanes
+        };
+
+        static constexpr std::uint32_t capacity = 1u << 16; // 65536 samples per lane, power-of-two.
+        std::array<std::array<float, capacity>, numLanes> lanes {};
+        std::atomic<std::uint64_t> writeIndex { 0 };   // Published end (acquire to read lanes)
+        std::atomic<std::uint64_t> reserveIndex { 0 }; // End of the block being written
 
         void clear() noexcept;
-        void push(const float* leftIn, const float* rightIn, int numSamples) noexcept;
-        void copyLatest(float* leftOut, float* rightOut, int numSamples) const noexcept;
+        // Writer (audio thread). numSamples must not exceed capacity.
+        void beginWrite(int numSamples) noexcept;
+        // Fills samples [offset, offset + numSamples) of the reserved block; nullptr writes silence.
+        void writeLane(int lane, const float* source, int numSamples, int offset = 0) noexcept;
+        void endWrite(int numSamples) noexcept;
+        // Reader. Returns false if the range was overwritten while copying.
+        std::uint64_t getWriteIndex() const noexcept { return writeIndex.load(std::memory_order_acquire); }
+        bool copyRange(int lane, std::uint64_t startIndex, float* destination, int numSamples) const noexcept;
     };
+    struct AnalyzerHistory;
 
     DiagnosticFeatureFlags diagnosticFeatureFlags;
     AnalyzerRuntimeConfig analyzerRuntimeConfig;
-    StereoTapRingBuffer inputTapRing;
-    StereoTapRingBuffer wetTapRing;
-    StereoTapRingBuffer outputTapRing;
-    juce::AudioBuffer<float> dryTapBuffer;
-    juce::AudioBuffer<float> wetEstimateBuffer;
+    AnalyzerTapRing analyzerTapRing;
+    int pendingTapSamples = 0;    // Audio thread: size of the reserved tap block
+    int wetTapSamplesWritten = 0; // Audio thread: wet lanes filled so far (next wet tap offset)
+    static void pushWetTap(void* context, const float* left, const float* right, int numSamples);
     std::array<AnalyzerSnapshot, 2> analyzerSnapshots {};
     std::atomic<int> activeAnalyzerSnapshotIndex { 0 };
     std::atomic<std::uint64_t> analyzerSequenceCounter { 0 };
     std::unique_ptr<AnalyzerWorker> analyzerWorker;
+    std::unique_ptr<AnalyzerHistory> analyzerHistory; // Analyzer-thread only
+    juce::CriticalSection analyzerDemandLock;
+    std::array<int, 4> analyzerCardDemandCounts {}; // modulation, spectrum, transfer, telemetry (guarded by analyzerDemandLock)
+    bool analyzerPlaybackPrepared = false;           // guarded by analyzerDemandLock
+    void changeAnalyzerCardDemand(bool modulation, bool spectrum, bool transfer, bool telemetry, int delta);
+    void updateAnalyzerWorkerStateLocked();
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ChoroborosAudioProcessor)
 };
@@ -0,0 +1,138 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "PluginStateCodec.h"
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+void writeU16(std::uint8_t* dst, std::uint16_t value) noexcept
+{
+    dst[0] = static_cast<std::uint8_t>(value & 0xffu);
+    dst[1] = static_cast<std::uint8_t>((value >> 8) & 0xffu);
+}
+
+void writeU32(std::uint8_t* dst, std::uint32_t value) noexcept
+{
+    for (int i = 0; i < 4; ++i)
+        dst[i] = static_cast<std::uint8_t>((value >> (8 * i)) & 0xffu);
+}
+
+std::uint16_t readU16(const std::uint8_t* src) noexcept
+{
+    return static_cast<std::uint16_t>(src[0] | (src[1] << 8));
+}
+
+std::uint32_t readU32(const std::uint8_t* src) noexcept
+{
+    std::uint32_t value = 0;
+    for (int i = 0; i < 4; ++i)
+        value |= static_cast<std::uint32_t>(src[i]) << (8 * i);
+    return value;
+}
+} // namespace
+
+std::uint32_t PluginStateCodec::crc32(const std::uint8_t* data, std::size_t size) noexcept
+{
+    // Bitwise CRC-32 (IEEE); the payload is a few dozen bytes, so a table buys nothing.
+    std::uint32_t crc = 0xffffffffu;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit)
+            crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1u)));
+    }
+    return ~crc;
+}
+
+std::array<std::uint8_t, PluginStateCodec::kEncodedSize> PluginStateCodec::encode() const noexcept
+{
+    std::array<std::uint8_t, kEncodedSize> bytes {};
+    auto* payload = bytes.data() + kHeaderSize;
+
+    auto* cursor = payload;
+    for (const float value : parameterValues)
+    {
+        std::uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writeU32(cursor, bits);
+        cursor += 4;
+    }
+    *cursor++ = modularCoresEnabled ? 1u : 0u;
+    for (int color = 0; color < choroboros::kEngineColorCount; ++color)
+        for (int mode = 0; mode < choroboros::kEngineModeCount; ++mode)
+            *cursor++ = static_cast<std::uint8_t>(coreAssignments.get(color, choroboros::hqEnabledFromMode(mode)));
+
+    writeU32(bytes.data(), kMagic);
+    writeU16(bytes.data() + 4, kVersion);
+    writeU16(bytes.data() + 6, static_cast<std::uint16_t>(kNumParameters));
+    writeU32(bytes.data() + 8, static_cast<std::uint32_t>(kPayloadSize));
+    writeU32(bytes.data() + 12, crc32(payload, kPayloadSize));
+    return bytes;
+}
+
+PluginStateCodec::DecodeResult PluginStateCodec::decode(const void* data,
+                                                        std::size_t sizeInBytes,
+                                                        PluginStateCodec& out) noexcept
+{
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    if (bytes == nullptr || sizeInBytes < 4 || readU32(bytes) != kMagic)
+        return DecodeResult::notBinary;
+    if (sizeInBytes < kHeaderSize)
+        return DecodeResult::corrupt;
+
+    const auto version = readU16(bytes + 4);
+    const auto numParameters = static_cast<int>(readU16(bytes + 6));
+    const auto payloadSize = static_cast<std::size_t>(readU32(bytes + 8));
+    if (version != kVersion)
+        return DecodeResult::unsupportedVersion;
+    if (numParameters != kNumParameters || payloadSize != kPayloadSize
+        || sizeInBytes < kHeaderSize + payloadSize)
+        return DecodeResult::corrupt;
+
+    const auto* payload = bytes + kHeaderSize;
+    if (crc32(payload, payloadSize) != readU32(bytes + 12))
+        return DecodeResult::corrupt;
+
+    PluginStateCodec decoded;
+    const auto* cursor = payload;
+    for (auto& value : decoded.parameterValues)
+    {
+        const std::uint32_t bits = readU32(cursor);
+        std::memcpy(&value, &bits, sizeof(value));
+        cursor += 4;
+        if (!std::isfinite(value))
+            return DecodeResult::corrupt;
+    }
+    decoded.modularCoresEnabled = *cursor++ != 0;
+    for (int color = 0; color < choroboros::kEngineColorCount; ++color)
+    {
+        for (int mode = 0; mode < choroboros::kEngineModeCount; ++mode)
+        {
+            const auto coreIndex = *cursor++;
+            if (coreIndex >= choroboros::coreIdCount())
+                return DecodeResult::corrupt;
+            decoded.coreAssignments.set(color, choroboros::hqEnabledFromMode(mode),
+                                        static_cast<choroboros::CoreId>(coreIndex));
+        }
+    }
+
+    out = decoded;
+    return DecodeResult::ok;
+}
@@ -0,0 +1,62 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../DSP/CoreAssignments.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Versioned binary plugin state chunk.
+ * Fixed little-endian layout: a 16-byte header (magic, version, parameter count, payload size,
+ * CRC-32 of the payload) followed by plain parameter values, the modular flag and the core
+ * assignment table. Decoding is a bounds-checked read with no allocation or parsing.
+ * Older sessions stored XML; the processor keeps reading those as a fallback.
+ */
+struct PluginStateCodec
+{
+    static constexpr std::uint32_t kMagic = 0x42524843u; // "CHRB"
+    static constexpr std::uint16_t kVersion = 1;
+    static constexpr int kNumParameters = 8;
+    static constexpr std::size_t kHeaderSize = 16;
+    static constexpr std::size_t kNumAssignmentSlots =
+        static_cast<std::size_t>(choroboros::kEngineColorCount * choroboros::kEngineModeCount);
+    static constexpr std::size_t kPayloadSize =
+        static_cast<std::size_t>(kNumParameters) * sizeof(float) + 1 + kNumAssignmentSlots;
+    static constexpr std::size_t kEncodedSize = kHeaderSize + kPayloadSize;
+
+    enum class DecodeResult
+    {
+        ok,
+        notBinary,          // No magic: caller should try the legacy XML path
+        corrupt,            // Truncated, bad checksum or out-of-range values
+        unsupportedVersion
+    };
+
+    // Plain (denormalised) values in the order defined by the processor for this version.
+    std::array<float, kNumParameters> parameterValues {};
+    bool modularCoresEnabled = false;
+    choroboros::CoreAssignmentTable coreAssignments;
+
+    std::array<std::uint8_t, kEncodedSize> encode() const noexcept;
+    static DecodeResult decode(const void* data, std::size_t sizeInBytes, PluginStateCodec& out) noexcept;
+
+    static std::uint32_t crc32(const std::uint8_t* data, std::size_t size) noexcept;
+};
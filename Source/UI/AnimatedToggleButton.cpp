@@ -20,6 +20,7 @@
 #include "BinaryData.h"
 
 AnimatedToggleButton::AnimatedToggleButton()
+    : UiAnimationDriver::Client(*this)
 {
     setSliderStyle(juce::Slider::LinearVertical);
     setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
@@ -46,7 +47,7 @@ void AnimatedToggleButton::paint(juce::Graphics& g)
 {
     // Frame 0 = switch UP = HQ on. Frame 17 = switch DOWN = HQ off.
     const float targetFrame = (getValue() >= 0.5) ? 0.0f : static_cast<float>(kNumFrames - 1);
-    if (!isTimerRunning() && std::abs(animatedFrame - targetFrame) > 0.01f)
+    if (!isAnimating() && std::abs(animatedFrame - targetFrame) > 0.01f)
         animatedFrame = targetFrame;
 
     static const juce::Image sheet = juce::ImageCache::getFromMemory(BinaryData::switch_a_spritesheet_png, BinaryData::switch_a_spritesheet_pngSize);
@@ -73,7 +74,7 @@ void AnimatedToggleButton::startAnimationToState(bool on)
     animationEndFrame = target;
     animationStartMs = juce::Time::getMillisecondCounterHiRes();
     animationRunning = true;
-    startTimerHz(120);
+    startAnimating();
 }
 
 void AnimatedToggleButton::commitToggleState(bool newState, juce::NotificationType notificationType)
@@ -88,8 +89,7 @@ void AnimatedToggleButton::mouseDown(const juce::MouseEvent& e)
     dragStartScreenY = e.getScreenPosition().y;
     dragAnchorScreenY = dragStartScreenY;
     pointerIsDown = true;
-    if (!isTimerRunning())
-        startTimerHz(120);
+    startAnimating();
 }
 
 void AnimatedToggleButton::mouseDrag(const juce::MouseEvent& e)
@@ -110,8 +110,11 @@ void AnimatedToggleButton::mouseDoubleClick(const juce::MouseEvent& e)
     commitToggleState(getValue() < 0.5, juce::sendNotificationSync);
 }
 
-void AnimatedToggleButton::timerCallback()
+bool AnimatedToggleButton::advanceAnimation(double elapsedMs)
 {
+    // Eased against the absolute start time, so frame pacing cannot stretch the switch throw.
+    juce::ignoreUnused(elapsedMs);
+
     if (pointerIsDown)
     {
         const int currentScreenY = juce::Desktop::getInstance().getMousePosition().y;
@@ -131,13 +134,12 @@ void AnimatedToggleButton::timerCallback()
             animatedFrame = animationEndFrame;
             animationRunning = false;
         }
-        repaint();
+        markAnimationDirty();
         if (onAnimationTick)
             onAnimationTick();
     }
 
-    if (!pointerIsDown && !animationRunning)
-        stopTimer();
+    return pointerIsDown || animationRunning;
 }
 
 void AnimatedToggleButton::tryCommitDragAtScreenY(int screenY)
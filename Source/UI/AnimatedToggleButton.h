@@ -20,8 +20,9 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <functional>
+#include "UiAnimationDriver.h"
 
-class AnimatedToggleButton : public juce::Slider, public juce::Timer
+class AnimatedToggleButton : public juce::Slider, private UiAnimationDriver::Client
 {
 public:
     AnimatedToggleButton();
@@ -38,9 +39,9 @@ public:
     void mouseDrag(const juce::MouseEvent& e) override;
     void mouseUp(const juce::MouseEvent& e) override;
     void mouseDoubleClick(const juce::MouseEvent& e) override;
-    void timerCallback() override;
     
 private:
+    bool advanceAnimation(double elapsedMs) override;
     void startAnimationToState(bool on);
     void commitToggleState(bool newState, juce::NotificationType notificationType = juce::sendNotificationSync);
     void tryCommitDragAtScreenY(int screenY);
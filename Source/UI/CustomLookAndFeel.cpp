@@ -54,22 +54,6 @@ static juce::Image loadImageFromBinary(const char* data, int size)
     return juce::ImageFileFormat::loadFrom(data, static_cast<size_t>(size));
 }
 
-namespace
-{
-struct SharedThemeAssetCache
-{
-    juce::CriticalSection lock;
-    std::array<CustomLookAndFeel::ThemeAssetPack, 5> packs {};
-    std::array<bool, 5> valid { false, false, false, false, false };
-};
-
-SharedThemeAssetCache& getSharedThemeAssetCache()
-{
-    static SharedThemeAssetCache cache;
-    return cache;
-}
-} // namespace
-
 CustomLookAndFeel::CustomLookAndFeel()
 {
 }
@@ -95,38 +79,31 @@ bool CustomLookAndFeel::isThemeCached(int colorIndex) const noexcept
     return cachedThemeValid[static_cast<size_t>(colorIndex)];
 }
 
-bool CustomLookAndFeel::isThemeAssetPackCached(int colorIndex) noexcept
+bool CustomLookAndFeel::isThemeAssetPackCached(int colorIndex, bool useBakedSprites) noexcept
 {
-    colorIndex = juce::jlimit(0, 4, colorIndex);
-    const auto index = static_cast<size_t>(colorIndex);
-    const auto& cache = getSharedThemeAssetCache();
-    const juce::ScopedLock lock(cache.lock);
-    return cache.valid[index];
+    return juce::SharedResourcePointer<ThemeAssetCache>()->hasThemePack(colorIndex, useBakedSprites);
 }
 
-CustomLookAndFeel::ThemeAssetPack CustomLookAndFeel::getOrDecodeThemeAssetPack(int colorIndex)
+CustomLookAndFeel::ThemeAssetPack CustomLookAndFeel::getOrDecodeThemeAssetPack(int colorIndex, bool useBakedSprites)
 {
-    colorIndex = juce::jlimit(0, 4, colorIndex);
-    const auto index = static_cast<size_t>(colorIndex);
-    auto& cache = getSharedThemeAssetCache();
-
-    {
-        const juce::ScopedLock lock(cache.lock);
-        if (cache.valid[index])
-            return cache.packs[index];
-    }
+    // Callers on decode threads keep the shared cache alive for the duration of the decode.
+    return juce::SharedResourcePointer<ThemeAssetCache>()->getThemePack(colorIndex, useBakedSprites);
+}
 
-    auto decoded = decodeThemeAssetPack(colorIndex);
+bool CustomLookAndFeel::shouldUseBakedSprites(float displayScale)
+{
+    const float bakedScale = SpriteBundle::getBakedScale();
+    return bakedScale > 0.0f && displayScale <= bakedScale + 0.01f;
+}
 
-    {
-        const juce::ScopedLock lock(cache.lock);
-        if (!cache.valid[index])
-        {
-            cache.packs[index] = decoded;
-            cache.valid[index] = true;
-        }
-        return cache.packs[index];
-    }
+void CustomLookAndFeel::setUseBakedSprites(bool shouldUse)
+{
+    if (useBakedSprites == shouldUse)
+        return;
+    useBakedSprites = shouldUse;
+    cachedThemeValid.fill(false);
+    if (currentColorIndex >= 0)
+        loadImages(currentColorIndex);
 }
 
 void CustomLookAndFeel::installThemeAssetPack(int colorIndex, ThemeAssetPack&& pack)
@@ -135,13 +112,7 @@ void CustomLookAndFeel::installThemeAssetPack(int colorIndex, ThemeAssetPack&& p
     auto& cachedPack = cachedThemeAssets[static_cast<size_t>(colorIndex)];
     cachedPack = std::move(pack);
     cachedThemeValid[static_cast<size_t>(colorIndex)] = true;
-
-    {
-        auto& sharedCache = getSharedThemeAssetCache();
-        const juce::ScopedLock lock(sharedCache.lock);
-        sharedCache.packs[static_cast<size_t>(colorIndex)] = cachedPack;
-        sharedCache.valid[static_cast<size_t>(colorIndex)] = true;
-    }
+    sharedThemeAssets->storeThemePack(colorIndex, useBakedSprites, cachedPack);
 
     if (currentColorIndex == colorIndex)
         applyThemeAssetPack(cachedPack);
@@ -180,7 +151,7 @@ void CustomLookAndFeel::loadImages(int colorIndex)
 
     if (!isCached)
     {
-        cachedPack = getOrDecodeThemeAssetPack(colorIndex);
+        cachedPack = sharedThemeAssets->getThemePack(colorIndex, useBakedSprites);
         isCached = true;
     }
 
@@ -200,9 +171,28 @@ void CustomLookAndFeel::applyThemeAssetPack(const ThemeAssetPack& pack)
     knobSpriteSheetOffsetImage = pack.knobSpriteSheetOffsetImage;
     knobSpriteSheetWidthImage = pack.knobSpriteSheetWidthImage;
     mixKnobSpriteSheetImage = pack.mixKnobSpriteSheetImage;
+    bakedRateSheet = pack.bakedRateSheet;
+    bakedDepthSheet = pack.bakedDepthSheet;
+    bakedOffsetSheet = pack.bakedOffsetSheet;
+    bakedWidthSheet = pack.bakedWidthSheet;
+    bakedMixSheet = pack.bakedMixSheet;
+}
+
+const SpriteBundle* CustomLookAndFeel::getBakedSheetFor(const juce::String& knobId, bool isMixKnob) const noexcept
+{
+    if (isMixKnob)
+        return bakedMixSheet.get();
+    // Same selection as the PNG path: per-control sheets where a theme has them, else the shared one.
+    if (knobId == "Depth" && bakedDepthSheet != nullptr)
+        return bakedDepthSheet.get();
+    if (knobId == "Offset" && bakedOffsetSheet != nullptr)
+        return bakedOffsetSheet.get();
+    if (knobId == "Width" && bakedWidthSheet != nullptr)
+        return bakedWidthSheet.get();
+    return bakedRateSheet.get();
 }
 
-CustomLookAndFeel::ThemeAssetPack CustomLookAndFeel::decodeThemeAssetPack(int colorIndex)
+CustomLookAndFeel::ThemeAssetPack CustomLookAndFeel::decodeThemeAssetPack(int colorIndex, bool useBakedSprites)
 {
     ThemeAssetPack pack;
 
@@ -264,11 +254,29 @@ CustomLookAndFeel::ThemeAssetPack CustomLookAndFeel::decodeThemeAssetPack(int co
         return image;
     };
 
-    pack.knobSpriteSheetRateImage = loadKnobSheet(knobSheetRateName, knobSheetRateSize);
-    pack.knobSpriteSheetDepthImage = loadKnobSheet(knobSheetDepthName, knobSheetDepthSize);
-    pack.knobSpriteSheetOffsetImage = loadKnobSheet(knobSheetOffsetName, knobSheetOffsetSize);
-    pack.knobSpriteSheetWidthImage = loadKnobSheet(knobSheetWidthName, knobSheetWidthSize);
-    pack.mixKnobSpriteSheetImage = loadKnobSheet(mixKnobSpriteSheetName, mixKnobSpriteSheetSize);
+    // Prefer build-time baked frames; only sheets without a bundle are decoded from PNG.
+    static constexpr std::array<const char*, 5> themeTokens { "green", "blue", "red", "purple", "black" };
+    const juce::String themeToken(themeTokens[static_cast<size_t>(colorIndex)]);
+    auto loadSheet = [&](const char* name, int size, const char* bakedSuffix,
+                         std::shared_ptr<const SpriteBundle>& baked) -> juce::Image {
+        if (!name || size <= 0)
+            return {};
+        if (useBakedSprites)
+        {
+            baked = SpriteBundle::findBaked((themeToken + "_" + bakedSuffix + "_sprites").toRawUTF8());
+            if (baked != nullptr)
+                return {};
+        }
+        return loadKnobSheet(name, size);
+    };
+
+    const bool sharedMainSheet = knobSheetDepthName == nullptr;
+    pack.knobSpriteSheetRateImage = loadSheet(knobSheetRateName, knobSheetRateSize,
+                                              sharedMainSheet ? "knob" : "rate", pack.bakedRateSheet);
+    pack.knobSpriteSheetDepthImage = loadSheet(knobSheetDepthName, knobSheetDepthSize, "depth", pack.bakedDepthSheet);
+    pack.knobSpriteSheetOffsetImage = loadSheet(knobSheetOffsetName, knobSheetOffsetSize, "offset", pack.bakedOffsetSheet);
+    pack.knobSpriteSheetWidthImage = loadSheet(knobSheetWidthName, knobSheetWidthSize, "width", pack.bakedWidthSheet);
+    pack.mixKnobSpriteSheetImage = loadSheet(mixKnobSpriteSheetName, mixKnobSpriteSheetSize, "mix", pack.bakedMixSheet);
 
     return pack;
 }
@@ -448,6 +456,27 @@ void CustomLookAndFeel::drawRotarySlider(juce::Graphics& g, int x, int y, int wi
         return (availableFrames - 1) - juce::jlimit(0, availableFrames - 1, remappedForwardIndex);
     };
 
+    // Build-time baked frames: already sliced, opaque-fixed and sized for this layout.
+    if (const auto* baked = getBakedSheetFor(slider.getComponentID(), isMixKnob))
+    {
+        const juce::Image frame = baked->getFrame(selectFilmstripFrameIndex(mappedVisualSliderPos, baked->getNumFrames()));
+        g.saveState();
+        g.setOpacity(1.0f);
+        if (currentColorIndex == 3 && !isMixKnob)
+        {
+            // Purple knob shadow extends below frame; add bottom overflow so it isn't clipped
+            constexpr int shadowOverflowBottom = 12;
+            g.drawImageWithin(frame, x, y, width, height + shadowOverflowBottom,
+                              juce::RectanglePlacement::centred, false);
+        }
+        else
+        {
+            g.drawImage(frame, x, y, width, height, 0, 0, frame.getWidth(), frame.getHeight());
+        }
+        g.restoreState();
+        return;
+    }
+
     // Green theme filmstrip knobs (individual sheets per control)
     if (currentColorIndex == 0 && !isMixKnob)
     {
@@ -21,26 +21,14 @@
 #include <juce_graphics/juce_graphics.h>
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <array>
+#include "ThemeAssetCache.h"
 
 class SmoothedSlider; // Forward declaration
 
 class CustomLookAndFeel : public juce::LookAndFeel_V4
 {
 public:
-    struct ThemeAssetPack
-    {
-        juce::Image knobBaseImage;
-        juce::Image knobIndicatorImage;
-        juce::Image knobShadowOverlayImage;
-        juce::Image sliderTrackImage;
-        juce::Image sliderThumbImage;
-        juce::Image mixKnobImage;
-        juce::Image knobSpriteSheetRateImage;
-        juce::Image knobSpriteSheetDepthImage;
-        juce::Image knobSpriteSheetOffsetImage;
-        juce::Image knobSpriteSheetWidthImage;
-        juce::Image mixKnobSpriteSheetImage;
-    };
+    using ThemeAssetPack = ThemeAssetCache::ThemeAssetPack;
 
     CustomLookAndFeel();
     ~CustomLookAndFeel() override = default;
@@ -49,10 +37,15 @@ public:
     void setColorTheme(int colorIndex);
     void setThemeColorIndexOnly(int colorIndex) noexcept;
     bool isThemeCached(int colorIndex) const noexcept;
-    static bool isThemeAssetPackCached(int colorIndex) noexcept;
+    static bool isThemeAssetPackCached(int colorIndex, bool useBakedSprites) noexcept;
     void installThemeAssetPack(int colorIndex, ThemeAssetPack&& pack);
-    static ThemeAssetPack getOrDecodeThemeAssetPack(int colorIndex);
-    static ThemeAssetPack decodeThemeAssetPack(int colorIndex);
+    static ThemeAssetPack getOrDecodeThemeAssetPack(int colorIndex, bool useBakedSprites);
+    static ThemeAssetPack decodeThemeAssetPack(int colorIndex, bool useBakedSprites);
+
+    // Baked knob frames are used when the build has them and they are not upscaled on this display.
+    static bool shouldUseBakedSprites(float displayScale);
+    void setUseBakedSprites(bool shouldUse);
+    bool isUsingBakedSprites() const noexcept { return useBakedSprites; }
     
     void drawRotarySlider(juce::Graphics& g, int x, int y, int width, int height,
                          float sliderPos, float rotaryStartAngle, float rotaryEndAngle,
@@ -100,15 +93,23 @@ private:
     juce::Image knobSpriteSheetOffsetImage;
     juce::Image knobSpriteSheetWidthImage;
     juce::Image mixKnobSpriteSheetImage;
+    std::shared_ptr<const SpriteBundle> bakedRateSheet;
+    std::shared_ptr<const SpriteBundle> bakedDepthSheet;
+    std::shared_ptr<const SpriteBundle> bakedOffsetSheet;
+    std::shared_ptr<const SpriteBundle> bakedWidthSheet;
+    std::shared_ptr<const SpriteBundle> bakedMixSheet;
     juce::Typeface::Ptr uiTextTypeface;
     float popupMenuFontHeight = 0.0f;
     
+    juce::SharedResourcePointer<ThemeAssetCache> sharedThemeAssets;
     std::array<ThemeAssetPack, 5> cachedThemeAssets {};
     std::array<bool, 5> cachedThemeValid { false, false, false, false, false };
     int currentColorIndex = -1; // 0=Green, 1=Blue, 2=Red, 3=Purple, 4=Black
+    bool useBakedSprites = false;
     
     void loadImages(int colorIndex);
     void applyThemeAssetPack(const ThemeAssetPack& pack);
+    const SpriteBundle* getBakedSheetFor(const juce::String& knobId, bool isMixKnob) const noexcept;
     juce::Colour getThemeAccentColour() const;
     juce::Colour getThemePanelColour() const;
     juce::Colour getThemePanelOutlineColour() const;
@@ -28,6 +28,9 @@ using namespace devpanel;
 
 DevPanel::~DevPanel()
 {
+    stopTimer();
+    viewport.onVisibleAreaChanged = nullptr;
+    processor.releaseAnalyzerCardDemand(lastModulationDemand, lastSpectrumDemand, lastTransferDemand, lastTelemetryDemand);
     if (tooltipWindow != nullptr)
         tooltipWindow->setLookAndFeel(nullptr);
     devEngineModeBox.setLookAndFeel(nullptr);
@@ -37,8 +40,9 @@ DevPanel::~DevPanel()
     setLookAndFeel(nullptr);
 }
 
-DevPanel::DevPanel(ChoroborosPluginEditor& editorRef, ChoroborosAudioProcessor& processorRef)
-    : editor(editorRef), processor(processorRef)
+DevPanel::DevPanel(ChoroborosPluginEditor& editorRef, ChoroborosAudioProcessor& processorRef,
+                   bool deferTabBuildUntilShown)
+    : editor(editorRef), processor(processorRef), tabBuildDeferred(deferTabBuildUntilShown)
 {
     setLookAndFeel(&getDevPanelThemeLookAndFeel());
     viewport.setLookAndFeel(&getDevPanelThemeLookAndFeel());
@@ -49,6 +53,8 @@ DevPanel::DevPanel(ChoroborosPluginEditor& editorRef, ChoroborosAudioProcessor&
     getDevPanelSectionLookAndFeel().refreshThemeColours();
     tooltipWindow = std::make_unique<juce::TooltipWindow>(this, 600);
     tooltipWindow->setLookAndFeel(&getDevPanelThemeLookAndFeel());
+    lockableInputPool = std::make_unique<LockableInputPool>();
+    viewport.onVisibleAreaChanged = [this] { updateVirtualizedRows(); };
     addAndMakeVisible(viewport);
     viewport.setViewedComponent(&content, false);
     viewport.setScrollBarsShown(true, false);
@@ -811,6 +817,7 @@ DevPanel::DevPanel(ChoroborosPluginEditor& editorRef, ChoroborosAudioProcessor&
             return false;
         });
         lockableProperties.add(prop);
+        virtualizedLockables.add(prop);
         registerConsoleTarget(prop, name);
         return prop;
     };
@@ -821,7 +828,7 @@ DevPanel::DevPanel(ChoroborosPluginEditor& editorRef, ChoroborosAudioProcessor&
                                      float displayScale = 1.0f) -> juce::PropertyComponent*
     {
         const float safeScale = juce::jmax(0.0001f, displayScale);
-        return makeLockable(
+        auto* property = makeLockable(
             makeFloatValue(
                 [this, paramId, safeScale]
                 {
@@ -846,6 +853,10 @@ DevPanel::DevPanel(ChoroborosPluginEditor& editorRef, ChoroborosAudioProcessor&
             static_cast<double>(maxDisplay),
             static_cast<double>(stepDisplay),
             static_cast<double>(skew));
+        // Lets `sweep` hand this control to the processor's audio-thread ramp queue.
+        property->getProperties().set("consoleRampParamId", juce::String(paramId));
+        property->getProperties().set("consoleRampDisplayScale", safeScale);
+        return property;
     };
 
     auto addParamMapping = [&](juce::Array<juce::PropertyComponent*>& props, const juce::String& name,
@@ -1110,7 +1121,7 @@ DevPanel::DevPanel(ChoroborosPluginEditor& editorRef, ChoroborosAudioProcessor&
 
     rightTabBuilt.fill(false);
     rightTabBuilt[6] = true; // Settings tab is constructed directly in this constructor.
-    ensureTabBuilt(0); // Overview is built eagerly; other tabs build on first access.
+    ensureTabBuilt(0); // Overview is built eagerly (unless deferred); other tabs build on first access.
 
     settingsPanel.clear();
 
@@ -34,6 +34,7 @@ namespace devpanel
 {
 struct ConsoleCommandResult;
 class LockableFloatPropertyComponent;
+class LockableInputPool;
 class CommandConsolePropertyComponent;
 }
 
@@ -54,6 +55,20 @@ public:
     }
 };
 
+/** Viewport that reports scrolling, so rows scrolled out of view can hand back their widgets. */
+class DevPanelViewport : public juce::Viewport
+{
+public:
+    std::function<void()> onVisibleAreaChanged;
+
+    void visibleAreaChanged(const juce::Rectangle<int>& newVisibleArea) override
+    {
+        juce::Viewport::visibleAreaChanged(newVisibleArea);
+        if (onVisibleAreaChanged)
+            onVisibleAreaChanged();
+    }
+};
+
 class VisualDeckContent : public juce::Component,
                           public juce::SettableTooltipClient
 {
@@ -175,14 +190,21 @@ class DevPanel : public juce::Component,
 {
 public:
     ~DevPanel() override;
-    DevPanel(ChoroborosPluginEditor& editorRef, ChoroborosAudioProcessor& processorRef);
+    // deferTabBuildUntilShown leaves every tab unbuilt until buildDeferredContent() (prewarmed windows).
+    DevPanel(ChoroborosPluginEditor& editorRef, ChoroborosAudioProcessor& processorRef,
+             bool deferTabBuildUntilShown = false);
     void resized() override;
+    void buildDeferredContent();
+    // Autocomplete list in the layout of docs/CONSOLE_AUTOCOMPLETE.json; the regression harness
+    // checks the doc against it and rewrites it with --write-autocomplete-json. Builds every tab
+    // first, so the list carries every console target rather than only those of opened tabs.
+    juce::String buildConsoleAutocompleteJson();
 
 private:
     ChoroborosPluginEditor& editor;
     ChoroborosAudioProcessor& processor;
 
-    juce::Viewport viewport;
+    DevPanelViewport viewport;
     DevPanelContent content;
     juce::Label mappingTitle;
     juce::Label mappingDescription;
@@ -271,6 +293,8 @@ private:
     juce::PropertyPanel layoutPurplePanel;
     juce::PropertyPanel layoutBlackPanel;
     juce::Array<juce::PropertyComponent*> lockableProperties;
+    juce::Array<devpanel::LockableFloatPropertyComponent*> virtualizedLockables;
+    std::unique_ptr<devpanel::LockableInputPool> lockableInputPool;
     juce::Array<juce::PropertyComponent*> liveReadoutProperties;
     juce::Array<juce::PropertyComponent*> overviewVisualDeckCards;
     juce::Array<juce::PropertyComponent*> modulationVisualDeckCards;
@@ -417,12 +441,14 @@ private:
     bool settingsConfirmResetFactory = true;
     bool settingsConfirmSetDefaults = true;
     bool settingsWarnOnUnlock = true;
-    bool lastModulationDemand = true;
-    bool lastSpectrumDemand = true;
-    bool lastTransferDemand = true;
-    bool lastTelemetryDemand = true;
+    // Analyzer cards this panel currently holds demand for (released in the destructor).
+    bool lastModulationDemand = false;
+    bool lastSpectrumDemand = false;
+    bool lastTransferDemand = false;
+    bool lastTelemetryDemand = false;
     std::unique_ptr<DevPanelBuildContext> buildContext;
     std::array<bool, 7> rightTabBuilt { { false, false, false, false, false, false, true } };
+    bool tabBuildDeferred = false;
     std::function<void(const juce::String&,
                        const juce::String&,
                        const juce::String&,
@@ -466,10 +492,12 @@ private:
     void updateMetadataSummary();
     void markLazyUiStateDirty();
     bool isPropertyVisibleInViewport(const juce::PropertyComponent* property) const;
+    void updateVirtualizedRows();
     void updateAnalyzerDemandFromVisibility();
     int refreshVisibleLiveReadouts();
     void registerConsoleTarget(juce::PropertyComponent* property, const juce::String& name);
     void refreshConsoleAutocompleteIfNeeded(bool force = false);
+    ConsoleTargetBinding* findConsoleTarget(const juce::String& userToken);
     devpanel::ConsoleCommandResult executeConsoleCommand(const juce::String& command);
     juce::StringArray buildConsoleAutocompleteCommands() const;
     void appendRecentTouchLogLine(const juce::String& line) const;
@@ -0,0 +1,219 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "DevPanelCommandIndex.h"
+#include <algorithm>
+#include <unordered_set>
+
+namespace devpanel
+{
+void ConsoleCompletionIndex::rebuild(const juce::StringArray& commandList)
+{
+    entries.clear();
+    entries.reserve(static_cast<size_t>(commandList.size()));
+    std::unordered_set<std::string> seenLower;
+    seenLower.reserve(static_cast<size_t>(juce::jmax(16, commandList.size())));
+    for (const auto& command : commandList)
+    {
+        const juce::String trimmed = command.trim();
+        if (trimmed.isEmpty())
+            continue;
+
+        std::string lower = trimmed.toLowerCase().toStdString();
+        if (seenLower.insert(lower).second)
+            entries.push_back({ trimmed, std::move(lower) });
+    }
+
+    // Store entries in rank order so every later comparison is a plain id comparison.
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b)
+    {
+        if (a.display.length() != b.display.length())
+            return a.display.length() < b.display.length();
+        return a.display.compareIgnoreCase(b.display) < 0;
+    });
+
+    std::vector<std::pair<std::string, int>> commandKeys;
+    std::vector<std::pair<std::string, int>> wordKeys;
+    commandKeys.reserve(entries.size());
+    wordKeys.reserve(entries.size() * 2);
+    for (size_t id = 0; id < entries.size(); ++id)
+    {
+        const auto& lower = entries[id].lower;
+        commandKeys.emplace_back(lower, static_cast<int>(id));
+        for (size_t pos = lower.find(' '); pos != std::string::npos; pos = lower.find(' ', pos + 1))
+            if (pos + 1 < lower.size())
+                wordKeys.emplace_back(lower.substr(pos + 1), static_cast<int>(id));
+    }
+
+    commandTrie.build(std::move(commandKeys), kMaxResults);
+    // Word matches may overlap the command-prefix tier by up to kMaxResults - 1 ids, so keep twice as many.
+    wordTrie.build(std::move(wordKeys), kMaxResults * 2);
+}
+
+juce::StringArray ConsoleCompletionIndex::complete(const juce::String& query, int maxResults) const
+{
+    juce::StringArray results;
+    const std::string lowerQuery = query.trim().toLowerCase().toStdString();
+    const int limit = juce::jlimit(0, kMaxResults, maxResults);
+    if (lowerQuery.empty() || entries.empty() || limit == 0)
+        return results;
+
+    auto startsWithQuery = [&lowerQuery](const std::string& text)
+    {
+        return text.compare(0, lowerQuery.size(), lowerQuery) == 0;
+    };
+
+    std::vector<int> picked;
+    picked.reserve(static_cast<size_t>(kMaxResults));
+    commandTrie.collect(lowerQuery, limit, picked);
+
+    // Fewer than limit command-prefix hits means picked holds that whole tier.
+    if (static_cast<int>(picked.size()) < limit)
+    {
+        std::vector<int> wordMatches;
+        wordTrie.collect(lowerQuery, kMaxResults * 2, wordMatches);
+        for (const int id : wordMatches)
+        {
+            if (static_cast<int>(picked.size()) >= limit)
+                break;
+            if (!startsWithQuery(entries[static_cast<size_t>(id)].lower))
+                picked.push_back(id);
+        }
+    }
+
+    if (static_cast<int>(picked.size()) < limit)
+    {
+        const std::string spacedQuery = " " + lowerQuery;
+        for (size_t id = 0; id < entries.size() && static_cast<int>(picked.size()) < limit; ++id)
+        {
+            const auto& lower = entries[id].lower;
+            if (lower.find(lowerQuery) == std::string::npos)
+                continue;
+            if (startsWithQuery(lower) || lower.find(spacedQuery) != std::string::npos)
+                continue;
+            picked.push_back(static_cast<int>(id));
+        }
+    }
+
+    results.ensureStorageAllocated(static_cast<int>(picked.size()));
+    for (const int id : picked)
+        results.add(entries[static_cast<size_t>(id)].display);
+    return results;
+}
+
+void ConsoleCompletionIndex::PrefixTrie::build(std::vector<std::pair<std::string, int>> keysToIndex, int listSize)
+{
+    keys = std::move(keysToIndex);
+    std::sort(keys.begin(), keys.end());
+    nodes.clear();
+    topIds.clear();
+    topListSize = juce::jmax(1, listSize);
+    if (!keys.empty())
+        buildNode(0, static_cast<int>(keys.size()), 0, 0);
+}
+
+int ConsoleCompletionIndex::PrefixTrie::buildNode(int begin, int end, size_t depth, char label)
+{
+    const int nodeIndex = static_cast<int>(nodes.size());
+    nodes.emplace_back();
+    nodes.back().begin = begin;
+    nodes.back().end = end;
+    nodes.back().label = label;
+
+    std::vector<int> ids;
+    ids.reserve(static_cast<size_t>(end - begin));
+    for (int i = begin; i < end; ++i)
+        ids.push_back(keys[static_cast<size_t>(i)].second);
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    const int distinct = static_cast<int>(ids.size());
+    nodes[static_cast<size_t>(nodeIndex)].topBegin = static_cast<int>(topIds.size());
+    nodes[static_cast<size_t>(nodeIndex)].topCount = juce::jmin(distinct, topListSize);
+    topIds.insert(topIds.end(), ids.begin(), ids.begin() + juce::jmin(distinct, topListSize));
+
+    // Small subtrees stay as a flat range: filtering a handful of keys beats more nodes.
+    if (distinct <= topListSize)
+    {
+        nodes[static_cast<size_t>(nodeIndex)].bucket = true;
+        return nodeIndex;
+    }
+
+    // Keys that end at this depth sort ahead of their extensions.
+    int i = begin;
+    while (i < end && keys[static_cast<size_t>(i)].first.size() == depth)
+        ++i;
+
+    int previousChild = -1;
+    while (i < end)
+    {
+        const char childLabel = keys[static_cast<size_t>(i)].first[depth];
+        int j = i + 1;
+        while (j < end && keys[static_cast<size_t>(j)].first[depth] == childLabel)
+            ++j;
+
+        const int child = buildNode(i, j, depth + 1, childLabel);
+        if (previousChild < 0)
+            nodes[static_cast<size_t>(nodeIndex)].firstChild = child;
+        else
+            nodes[static_cast<size_t>(previousChild)].nextSibling = child;
+        previousChild = child;
+        i = j;
+    }
+    return nodeIndex;
+}
+
+void ConsoleCompletionIndex::PrefixTrie::collect(const std::string& query, int maxResults, std::vector<int>& out) const
+{
+    if (nodes.empty() || maxResults <= 0)
+        return;
+
+    int nodeIndex = 0;
+    size_t depth = 0;
+    while (depth < query.size() && !nodes[static_cast<size_t>(nodeIndex)].bucket)
+    {
+        int child = nodes[static_cast<size_t>(nodeIndex)].firstChild;
+        while (child >= 0 && nodes[static_cast<size_t>(child)].label != query[depth])
+            child = nodes[static_cast<size_t>(child)].nextSibling;
+        if (child < 0)
+            return;
+        nodeIndex = child;
+        ++depth;
+    }
+
+    const auto& node = nodes[static_cast<size_t>(nodeIndex)];
+    if (depth == query.size())
+    {
+        const int count = juce::jmin(node.topCount, maxResults);
+        out.insert(out.end(), topIds.begin() + node.topBegin, topIds.begin() + node.topBegin + count);
+        return;
+    }
+
+    std::vector<int> matches;
+    for (int i = node.begin; i < node.end; ++i)
+    {
+        const auto& key = keys[static_cast<size_t>(i)];
+        if (key.first.compare(0, query.size(), query) == 0)
+            matches.push_back(key.second);
+    }
+    std::sort(matches.begin(), matches.end());
+    matches.erase(std::unique(matches.begin(), matches.end()), matches.end());
+    const int count = juce::jmin(static_cast<int>(matches.size()), maxResults);
+    out.insert(out.end(), matches.begin(), matches.begin() + count);
+}
+} // namespace devpanel
@@ -0,0 +1,87 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace devpanel
+{
+/**
+ * Prebuilt index over the console's autocomplete commands.
+ * Ranking matches the console's original linear scan: commands that start with the query come
+ * first, then commands with a later word starting with it, then any other substring match; within
+ * a tier, shorter commands win, then case-insensitive alphabetical order. The first two tiers are
+ * answered by walking prefix tries in O(query length); only queries with too few word matches
+ * fall through to a substring scan, which stops as soon as the result list is full.
+ */
+class ConsoleCompletionIndex
+{
+public:
+    static constexpr int kMaxResults = 8;
+
+    // Commands are trimmed and de-duplicated case-insensitively (first spelling wins).
+    void rebuild(const juce::StringArray& commandList);
+    juce::StringArray complete(const juce::String& query, int maxResults = kMaxResults) const;
+
+    int getNumCommands() const noexcept { return static_cast<int>(entries.size()); }
+
+private:
+    // Keys map to entry ids; entries are stored in rank order, so a lower id is a better match.
+    class PrefixTrie
+    {
+    public:
+        void build(std::vector<std::pair<std::string, int>> keysToIndex, int listSize);
+        // Appends up to maxResults distinct ids whose key starts with query, best first.
+        void collect(const std::string& query, int maxResults, std::vector<int>& out) const;
+
+    private:
+        struct Node
+        {
+            int begin = 0;         // Range of sorted keys sharing this node's prefix
+            int end = 0;
+            int firstChild = -1;
+            int nextSibling = -1;
+            int topBegin = 0;      // Best ids of the subtree, in topIds
+            int topCount = 0;
+            char label = 0;
+            bool bucket = false;   // Few enough ids that queries filter the range directly
+        };
+
+        int buildNode(int begin, int end, size_t depth, char label);
+
+        std::vector<std::pair<std::string, int>> keys;
+        std::vector<Node> nodes;
+        std::vector<int> topIds;
+        int topListSize = 0;
+    };
+
+    struct Entry
+    {
+        juce::String display;
+        std::string lower;
+    };
+
+    std::vector<Entry> entries;
+    PrefixTrie commandTrie; // Whole commands
+    PrefixTrie wordTrie;    // Every suffix that starts after a space
+};
+} // namespace devpanel
@@ -35,6 +35,108 @@ namespace
 {
 constexpr double kConsoleValueEpsilon = 1.0e-6;
 
+enum class ConsoleVerb
+{
+    unknown,
+    help,
+    clear,
+    alias,
+    copyJson,
+    saveDefaults,
+    tutorial,
+    core,
+    slot,
+    engine,
+    hq,
+    view,
+    bypass,
+    governor,
+    latency,
+    add,
+    sub,
+    set,
+    get,
+    toggle,
+    macro,
+    solo,
+    unsolo,
+    sweep,
+    reset,
+    lock,
+    unlock,
+    undo,
+    redo,
+    history,
+    watch,
+    unwatch,
+    fx,
+    dump,
+    diffFactory,
+    search,
+    stats,
+    list,
+    exportScript,
+    importScript
+};
+
+// Hash index over command verbs so dispatch is one lookup instead of a string comparison chain.
+ConsoleVerb lookupConsoleVerb(const juce::String& lowerAction)
+{
+    static const std::unordered_map<std::string, ConsoleVerb> verbs
+    {
+        { "help", ConsoleVerb::help },
+        { "clear", ConsoleVerb::clear },
+        { "alias", ConsoleVerb::alias },
+        { "cp", ConsoleVerb::copyJson },
+        { "save", ConsoleVerb::saveDefaults },
+        { "tutorial", ConsoleVerb::tutorial },
+        { "core", ConsoleVerb::core },
+        { "slot", ConsoleVerb::slot },
+        { "engine", ConsoleVerb::engine },
+        { "hq", ConsoleVerb::hq },
+        { "view", ConsoleVerb::view },
+        { "bypass", ConsoleVerb::bypass },
+        { "governor", ConsoleVerb::governor },
+        { "latency", ConsoleVerb::latency },
+        { "add", ConsoleVerb::add },
+        { "sub", ConsoleVerb::sub },
+        { "set", ConsoleVerb::set },
+        { "get", ConsoleVerb::get },
+        { "toggle", ConsoleVerb::toggle },
+        { "macro", ConsoleVerb::macro },
+        { "solo", ConsoleVerb::solo },
+        { "unsolo", ConsoleVerb::unsolo },
+        { "sweep", ConsoleVerb::sweep },
+        { "reset", ConsoleVerb::reset },
+        { "lock", ConsoleVerb::lock },
+        { "unlock", ConsoleVerb::unlock },
+        { "undo", ConsoleVerb::undo },
+        { "redo", ConsoleVerb::redo },
+        { "history", ConsoleVerb::history },
+        { "watch", ConsoleVerb::watch },
+        { "unwatch", ConsoleVerb::unwatch },
+        { "fx", ConsoleVerb::fx },
+        { "dump", ConsoleVerb::dump },
+        { "diff", ConsoleVerb::diffFactory },
+        { "search", ConsoleVerb::search },
+        { "stats", ConsoleVerb::stats },
+        { "list", ConsoleVerb::list },
+        { "export", ConsoleVerb::exportScript },
+        { "import", ConsoleVerb::importScript }
+    };
+    const auto it = verbs.find(lowerAction.toStdString());
+    return it != verbs.end() ? it->second : ConsoleVerb::unknown;
+}
+
+// Macro-parameter rows are tagged when built so sweeps can run on the processor's audio-thread ramps.
+juce::String rampParameterIdFor(const juce::PropertyComponent* property)
+{
+    if (property == nullptr)
+        return {};
+    const juce::String paramId = property->getProperties()["consoleRampParamId"].toString();
+    return ChoroborosAudioProcessor::supportsParameterRamp(paramId) ? paramId : juce::String();
+}
+
 juce::String formatConsoleValue(double value, int decimals = 6)
 {
     juce::String text(value, juce::jlimit(0, 8, decimals));
@@ -301,12 +403,7 @@ void DevPanel::registerConsoleTarget(juce::PropertyComponent* property, const ju
     int suffix = 2;
     auto slugExists = [this](const juce::String& slugToFind) -> bool
     {
-        for (const auto& item : consoleTargets)
-        {
-            if (item.slug == slugToFind)
-                return true;
-        }
-        return false;
+        return consoleTargetIndexBySlug.count(slugToFind.toStdString()) > 0;
     };
 
     while (slugExists(uniqueSlug))
@@ -335,6 +432,17 @@ void DevPanel::registerConsoleTarget(juce::PropertyComponent* property, const ju
     }
 }
 
+DevPanel::ConsoleTargetBinding* DevPanel::findConsoleTarget(const juce::String& userToken)
+{
+    // Exact (case-insensitive) slugs hit the index directly; anything else is normalised first.
+    auto it = consoleTargetIndexBySlug.find(userToken.trim().toLowerCase().toStdString());
+    if (it == consoleTargetIndexBySlug.end())
+        it = consoleTargetIndexBySlug.find(slugifyParameterName(userToken).toStdString());
+    if (it == consoleTargetIndexBySlug.end() || it->second >= consoleTargets.size())
+        return nullptr;
+    return &consoleTargets[it->second];
+}
+
 void DevPanel::refreshConsoleAutocompleteIfNeeded(bool force)
 {
     consoleAutocompleteRefreshQueued = false;
@@ -378,10 +486,12 @@ juce::StringArray DevPanel::buildConsoleAutocompleteCommands() const
         "engine green", "engine blue", "engine red", "engine purple", "engine black",
         "hq on", "hq off", "hq true", "hq false", "hq 1", "hq 0",
         "bypass on", "bypass off", "bypass true", "bypass false", "bypass 1", "bypass 0",
+        "governor on", "governor off",
+        "latency", "latency reset", "latency export", "latency miss 0.5",
         "toggle hq", "toggle bypass",
         "view overview", "view modulation", "view internals", "view tone", "view bbd",
         "view engine", "view tape", "view layout", "view look", "view lookfeel", "view validation", "view settings",
-        "macro rate", "macro depth", "macro offset", "macro width", "macro color", "macro mix",
+        "macro rate", "macro depth", "macro offset", "macro width", "macro color", "macro mix", "macro depth 75 500",
         "dump green", "dump blue", "dump red", "dump purple", "dump black",
         "list green", "list blue", "list red", "list purple", "list black", "list globals",
         "list green all", "list blue all", "list red all", "list purple all", "list black all",
@@ -406,6 +516,9 @@ juce::StringArray DevPanel::buildConsoleAutocompleteCommands() const
         }
     }
 
+    for (const auto& alias : consoleAliases)
+        addCommand(juce::String(alias.first));
+
     for (const auto& binding : consoleTargets)
     {
         const auto& slug = binding.slug;
@@ -425,6 +538,24 @@ juce::StringArray DevPanel::buildConsoleAutocompleteCommands() const
     return commands;
 }
 
+juce::String DevPanel::buildConsoleAutocompleteJson()
+{
+    buildDeferredContent();
+    for (int tab = 0; tab < static_cast<int>(rightTabBuilt.size()); ++tab)
+        ensureTabBuilt(tab);
+
+    const auto commands = buildConsoleAutocompleteCommands();
+    juce::String json;
+    json << "{\n  \"autocomplete_commands\": [\n";
+    for (int i = 0; i < commands.size(); ++i)
+    {
+        json << "    " << juce::JSON::toString(juce::var(commands[i]));
+        json << (i + 1 < commands.size() ? ",\n" : "\n");
+    }
+    json << "  ]\n}\n";
+    return json;
+}
+
 void DevPanel::appendRecentTouchLogLine(const juce::String& line) const
 {
     if (line.trim().isEmpty() || recentTouchesLogFile == juce::File())
@@ -455,18 +586,14 @@ juce::String DevPanel::buildConsoleWatchHudText() const
     for (int i = 0; i < maxVisible; ++i)
     {
         const auto& slug = consoleWatchSlugs[i];
-        const auto it = std::find_if(consoleTargets.begin(), consoleTargets.end(),
-                                     [&slug](const ConsoleTargetBinding& binding)
-                                     {
-                                         return binding.slug == slug;
-                                     });
-        if (it == consoleTargets.end())
+        const auto it = consoleTargetIndexBySlug.find(slug.toStdString());
+        if (it == consoleTargetIndexBySlug.end() || it->second >= consoleTargets.size())
         {
             parts.add(slug + "=?");
             continue;
         }
 
-        auto* lockable = dynamic_cast<const LockableFloatPropertyComponent*>(it->property);
+        auto* lockable = dynamic_cast<const LockableFloatPropertyComponent*>(consoleTargets[it->second].property);
         if (lockable == nullptr)
         {
             parts.add(slug + "=?");
@@ -484,6 +611,7 @@ juce::String DevPanel::buildConsoleWatchHudText() const
 void DevPanel::cancelConsoleSweeps()
 {
     consoleSweeps.clear();
+    processor.stopParameterRamps();
 }
 
 void DevPanel::updateConsoleSweeps()
@@ -508,14 +636,8 @@ void DevPanel::updateConsoleSweeps()
         const double value = sweep.startValue + (sweep.endValue - sweep.startValue) * alpha;
         sweep.lockable->setValueFromCommand(value);
 
-        for (auto& binding : consoleTargets)
-        {
-            if (binding.slug == sweep.slug)
-            {
-                binding.lastKnownValue = sweep.lockable->getCurrentValueForCommand();
-                break;
-            }
-        }
+        if (auto* binding = findConsoleTarget(sweep.slug))
+            binding->lastKnownValue = sweep.lockable->getCurrentValueForCommand();
 
         anyUpdated = true;
         if (sweep.tick >= sweep.totalTicks)
@@ -735,17 +857,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
 
     auto findTarget = [this](const juce::String& userToken) -> ConsoleTargetBinding*
     {
-        const juce::String normalized = slugifyParameterName(userToken);
-        const auto it = consoleTargetIndexBySlug.find(normalized.toStdString());
-        if (it != consoleTargetIndexBySlug.end() && it->second < consoleTargets.size())
-            return &consoleTargets[it->second];
-
-        for (auto& binding : consoleTargets)
-        {
-            if (binding.slug == normalized || binding.slug.equalsIgnoreCase(userToken))
-                return &binding;
-        }
-        return nullptr;
+        return findConsoleTarget(userToken);
     };
 
     auto setMappedParameter = [this](const juce::String& paramId, float mappedValue)
@@ -834,6 +946,8 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
             if (consoleSweeps[static_cast<size_t>(i)].slug == binding.slug)
                 consoleSweeps.erase(consoleSweeps.begin() + i);
         }
+        if (const auto rampParamId = rampParameterIdFor(binding.property); rampParamId.isNotEmpty())
+            processor.stopParameterRamps(rampParamId);
         lockable.setValueFromCommand(requestedValue);
         const double newValue = lockable.getCurrentValueForCommand();
 
@@ -886,8 +1000,9 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
 
     const juce::String action = tokens[0].toLowerCase();
+    const ConsoleVerb verb = lookupConsoleVerb(action);
 
-    if (action == "help")
+    if (verb == ConsoleVerb::help)
     {
         result.output =
             "Engine & Plugin State:\n"
@@ -895,6 +1010,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
             "  hq <on|off>\n"
             "  view <overview|modulation|tone|engine|layout|validation|settings>\n"
             "  bypass <on|off>\n"
+            "  governor <on|off>\n"
             "  slot show\n"
             "  slot set <green|blue|red|purple|black> <nq|hq> <core_id>\n"
             "  solo <node>\n"
@@ -909,7 +1025,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
             "  lock <target>\n"
             "  unlock <target>\n"
             "  toggle <target>\n"
-            "  macro <rate|depth|offset|width|color|mix> <0..100>\n"
+            "  macro <rate|depth|offset|width|color|mix> <0..100> [ramp_ms]\n"
             "  sweep <target> <start> <end> <time_ms>\n"
             "History:\n"
             "  undo [n], redo [n], history\n"
@@ -928,6 +1044,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
             "  diff factory\n"
             "  search <term>\n"
             "  stats\n"
+            "  latency [reset|export|miss <fraction>]\n"
             "  list <color> [all] [full]\n"
             "  list globals [full]\n"
             "  core list\n"
@@ -941,14 +1058,14 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "clear")
+    if (verb == ConsoleVerb::clear)
     {
         result.clearOutput = true;
         result.output = "Console cleared.";
         return result;
     }
 
-    if (action == "alias")
+    if (verb == ConsoleVerb::alias)
     {
         if (tokens.size() < 3)
         {
@@ -979,25 +1096,27 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         }
 
         consoleAliases[aliasName.toStdString()] = commandBody;
+        consoleAutocompleteDirty = true;
+        refreshConsoleAutocompleteIfNeeded();
         result.output = "Alias `" + aliasName + "` => `" + commandBody + "`";
         return result;
     }
 
-    if (action == "cp" && tokens.size() >= 2 && tokens[1].equalsIgnoreCase("json"))
+    if (verb == ConsoleVerb::copyJson && tokens.size() >= 2 && tokens[1].equalsIgnoreCase("json"))
     {
         juce::SystemClipboard::copyTextToClipboard(buildJson());
         result.output = "Copied current Dev Panel state JSON to clipboard.";
         return result;
     }
 
-    if (action == "save" && tokens.size() >= 2 && tokens[1].equalsIgnoreCase("defaults"))
+    if (verb == ConsoleVerb::saveDefaults && tokens.size() >= 2 && tokens[1].equalsIgnoreCase("defaults"))
     {
         saveCurrentAsDefaults();
         result.output = "Saved current state as user defaults.";
         return result;
     }
 
-    if (action == "tutorial")
+    if (verb == ConsoleVerb::tutorial)
     {
         if (tokens.size() >= 2)
         {
@@ -1057,7 +1176,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "core")
+    if (verb == ConsoleVerb::core)
     {
         if (tokens.size() < 2)
         {
@@ -1136,7 +1255,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "slot")
+    if (verb == ConsoleVerb::slot)
     {
         if (tokens.size() < 2)
         {
@@ -1235,7 +1354,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "engine")
+    if (verb == ConsoleVerb::engine)
     {
         if (tokens.size() < 2)
         {
@@ -1270,7 +1389,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "hq")
+    if (verb == ConsoleVerb::hq)
     {
         if (tokens.size() < 2)
         {
@@ -1303,7 +1422,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "view")
+    if (verb == ConsoleVerb::view)
     {
         if (tokens.size() < 2)
         {
@@ -1345,7 +1464,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "bypass")
+    if (verb == ConsoleVerb::bypass)
     {
         if (tokens.size() < 2)
         {
@@ -1386,7 +1505,78 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "add" || action == "sub")
+    if (verb == ConsoleVerb::governor)
+    {
+        bool shouldEnable = false;
+        if (tokens.size() < 2 || !parseOnOffToken(tokens[1], shouldEnable))
+        {
+            result.output = "ERROR: usage: governor <on|off>";
+            return result;
+        }
+
+        processor.setQualityGovernorEnabled(shouldEnable);
+        result.output = shouldEnable
+            ? "Quality governor enabled (realtime quality steps down under CPU pressure)."
+            : "Quality governor disabled (full quality always).";
+        return result;
+    }
+
+    if (verb == ConsoleVerb::latency)
+    {
+        const juce::String sub = tokens.size() >= 2 ? tokens[1].toLowerCase() : juce::String();
+        if (sub == "reset")
+        {
+            processor.resetProcessTimeHistogram();
+            result.output = "Block latency histogram reset.";
+            return result;
+        }
+        if (sub == "export")
+        {
+            result.output = processor.exportProcessTimeHistogram()
+                ? "Appended block latency histogram to " + ChoroborosAudioProcessor::getProcessTimeHistogramFile().getFullPathName()
+                : "ERROR: could not write " + ChoroborosAudioProcessor::getProcessTimeHistogramFile().getFullPathName();
+            return result;
+        }
+        if (sub == "miss")
+        {
+            const float fraction = tokens.size() >= 3 ? tokens[2].getFloatValue() : 0.0f;
+            if (fraction <= 0.0f || fraction > 4.0f)
+            {
+                result.output = "ERROR: usage: latency miss <fraction of deadline, e.g. 0.5>";
+                return result;
+            }
+            processor.setDeadlineMissFraction(fraction);
+            result.output = "Deadline miss threshold set to " + formatConsoleValue(fraction, 3) + " of the block deadline.";
+            return result;
+        }
+        if (sub.isNotEmpty())
+        {
+            result.output = "ERROR: usage: latency [reset|export|miss <fraction>]";
+            return result;
+        }
+
+        const auto& histogram = processor.getProcessTimeHistogram();
+        const auto summary = histogram.summarise();
+        juce::StringArray lines;
+        lines.add("Block latency (" + juce::String(static_cast<long long>(summary.blocks)) + " blocks):");
+        lines.add("  p50=" + formatConsoleValue(summary.p50Ms, 3)
+                  + " ms, p90=" + formatConsoleValue(summary.p90Ms, 3)
+                  + " ms, p99=" + formatConsoleValue(summary.p99Ms, 3)
+                  + " ms, p99.9=" + formatConsoleValue(summary.p999Ms, 3) + " ms");
+        lines.add("  deadline_misses=" + juce::String(static_cast<long long>(summary.deadlineMisses))
+                  + " (> " + formatConsoleValue(summary.deadlineMissFraction, 3) + " of deadline)");
+        for (int i = 0; i < choroboros::LatencyHistogram::kNumBuckets; ++i)
+        {
+            const auto count = histogram.getBucketCount(i);
+            if (count > 0)
+                lines.add("  <= " + formatConsoleValue(choroboros::LatencyHistogram::bucketUpperMs(i), 4)
+                          + " ms: " + juce::String(static_cast<long long>(count)));
+        }
+        result.output = lines.joinIntoString("\n");
+        return result;
+    }
+
+    if (verb == ConsoleVerb::add || verb == ConsoleVerb::sub)
     {
         if (tokens.size() < 3)
         {
@@ -1409,7 +1599,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
             result.output = "ERROR: invalid numeric delta `" + tokens[2] + "`.";
             return result;
         }
-        if (action == "sub")
+        if (verb == ConsoleVerb::sub)
             delta = -delta;
 
         const double current = lockable->getCurrentValueForCommand();
@@ -1426,7 +1616,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "set")
+    if (verb == ConsoleVerb::set)
     {
         if (tokens.size() < 3)
         {
@@ -1466,7 +1656,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "get")
+    if (verb == ConsoleVerb::get)
     {
         if (tokens.size() < 2)
         {
@@ -1497,7 +1687,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "toggle")
+    if (verb == ConsoleVerb::toggle)
     {
         if (tokens.size() < 2)
         {
@@ -1581,11 +1771,11 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "macro")
+    if (verb == ConsoleVerb::macro)
     {
         if (tokens.size() < 3)
         {
-            result.output = "ERROR: usage: macro <rate|depth|offset|width|color|mix> <0..100>";
+            result.output = "ERROR: usage: macro <rate|depth|offset|width|color|mix> <0..100> [ramp_ms]";
             return result;
         }
 
@@ -1611,9 +1801,25 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         }
         percent = juce::jlimit(0.0, 100.0, percent);
 
-        runSnapshotAction("macro " + macroName, [&, percent]
+        double rampMs = 0.0;
+        if (tokens.size() >= 4 && !parseConsoleDouble(tokens[3], rampMs))
+        {
+            result.output = "ERROR: macro ramp time must be numeric (ms).";
+            return result;
+        }
+        rampMs = juce::jlimit(0.0, 600000.0, rampMs);
+
+        runSnapshotAction("macro " + macroName, [&, percent, rampMs]
         {
+            // The snapshot action stops running ramps first, so this one is queued behind that stop.
+            // The end-value write below must not cancel the ramp it belongs to.
+            std::unique_ptr<ChoroborosAudioProcessor::ScopedRampEndWrite> rampEndWrite;
+            if (rampMs > 0.0)
+                if (auto* param = processor.getValueTreeState().getParameter(paramId))
+                    if (processor.queueParameterRamp(paramId, param->getValue(), static_cast<float>(percent * 0.01), rampMs))
+                        rampEndWrite = std::make_unique<ChoroborosAudioProcessor::ScopedRampEndWrite>(processor);
             setMacroPercent(paramId, percent);
+            rampEndWrite.reset();
             refreshAllPanels();
             updateActiveProfileLabel();
             updateRightTabVisibility();
@@ -1630,10 +1836,12 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         {
             result.output = "Macro " + macroName + " set to " + formatConsoleValue(percent, 2) + "%.";
         }
+        if (rampMs > 0.0)
+            result.output << " Audio ramp over " << formatConsoleValue(rampMs, 1) << " ms.";
         return result;
     }
 
-    if (action == "solo")
+    if (verb == ConsoleVerb::solo)
     {
         if (tokens.size() < 2)
         {
@@ -1672,7 +1880,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "unsolo")
+    if (verb == ConsoleVerb::unsolo)
     {
         if (!consoleSoloActive)
         {
@@ -1693,7 +1901,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "sweep")
+    if (verb == ConsoleVerb::sweep)
     {
         if (tokens.size() < 5)
         {
@@ -1734,6 +1942,52 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         }
 
         const double preSweepValue = lockable->getCurrentValueForCommand();
+        const juce::String rampParamId = rampParameterIdFor(binding->property);
+        if (rampParamId.isNotEmpty())
+        {
+            // Macro parameters ramp on the audio thread: the control jumps to the end value right away
+            // and the DSP follows the ramp sample by sample, with no timer work while it runs.
+            const double minValue = lockable->getMinimumForCommand();
+            const double maxValue = lockable->getMaximumForCommand();
+            const double rampStart = juce::jlimit(minValue, maxValue, startValue);
+            const double rampEnd = juce::jlimit(minValue, maxValue, endValue);
+            const float displayScale = juce::jmax(0.0001f, static_cast<float>(
+                static_cast<double>(binding->property->getProperties()["consoleRampDisplayScale"])));
+            const auto& range = processor.getValueTreeState().getParameterRange(rampParamId);
+            auto toNormalised = [&](double displayValue)
+            {
+                const float raw = processor.unmapParameterValue(rampParamId, static_cast<float>(displayValue) / displayScale);
+                return range.convertTo0to1(juce::jlimit(range.start, range.end, raw));
+            };
+
+            if (processor.queueParameterRamp(rampParamId, toNormalised(rampStart), toNormalised(rampEnd), timeMs))
+            {
+                {
+                    const ChoroborosAudioProcessor::ScopedRampEndWrite rampEndWrite(processor);
+                    lockable->setValueFromCommand(rampEnd);
+                }
+                binding->previousValue = preSweepValue;
+                binding->hasPreviousValue = true;
+                binding->lastKnownValue = lockable->getCurrentValueForCommand();
+
+                ConsoleAction historyAction;
+                historyAction.label = "sweep " + binding->slug;
+                historyAction.undo = [this, lockable, preSweepValue, rampParamId]()
+                {
+                    processor.stopParameterRamps(rampParamId);
+                    lockable->setValueFromCommand(preSweepValue);
+                };
+                historyAction.redo = [lockable, rampEnd]() { lockable->setValueFromCommand(rampEnd); };
+                pushAction(std::move(historyAction));
+
+                result.output = "Sweep started for " + binding->slug + ": "
+                              + formatConsoleValue(rampStart) + " -> "
+                              + formatConsoleValue(rampEnd) + " over "
+                              + formatConsoleValue(timeMs, 1) + " ms (audio-thread ramp).";
+                return result;
+            }
+        }
+
         lockable->setValueFromCommand(startValue);
         binding->previousValue = preSweepValue;
         binding->hasPreviousValue = true;
@@ -1762,7 +2016,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "reset")
+    if (verb == ConsoleVerb::reset)
     {
         if (tokens.size() < 2)
         {
@@ -1846,7 +2100,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "lock" || action == "unlock")
+    if (verb == ConsoleVerb::lock || verb == ConsoleVerb::unlock)
     {
         if (tokens.size() < 2)
         {
@@ -1868,7 +2122,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
             return result;
         }
 
-        const bool shouldLock = (action == "lock");
+        const bool shouldLock = (verb == ConsoleVerb::lock);
         const bool oldLock = lockable->isLocked();
         if (oldLock == shouldLock)
         {
@@ -1889,7 +2143,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "undo" || action == "redo")
+    if (verb == ConsoleVerb::undo || verb == ConsoleVerb::redo)
     {
         cancelConsoleSweeps();
         int count = 1;
@@ -1898,7 +2152,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         juce::StringArray messages;
         for (int i = 0; i < count; ++i)
         {
-            if (action == "undo")
+            if (verb == ConsoleVerb::undo)
             {
                 if (consoleUndoStack.empty())
                     break;
@@ -1924,21 +2178,21 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
 
         if (messages.isEmpty())
         {
-            result.output = (action == "undo")
+            result.output = (verb == ConsoleVerb::undo)
                 ? "Nothing to undo."
                 : "Nothing to redo.";
         }
         else
         {
             syncAllBindings(true);
-            result.output = (action == "undo")
+            result.output = (verb == ConsoleVerb::undo)
                 ? ("Undid " + juce::String(messages.size()) + " action(s).")
                 : ("Redid " + juce::String(messages.size()) + " action(s).");
         }
         return result;
     }
 
-    if (action == "history")
+    if (verb == ConsoleVerb::history)
     {
         juce::StringArray lines;
         lines.add("Recent console commands:");
@@ -1959,7 +2213,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "watch" || action == "unwatch")
+    if (verb == ConsoleVerb::watch || verb == ConsoleVerb::unwatch)
     {
         if (tokens.size() < 2)
         {
@@ -1977,7 +2231,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         }
         juce::ignoreUnused(lockable);
 
-        if (action == "watch")
+        if (verb == ConsoleVerb::watch)
         {
             if (!consoleWatchSlugs.contains(binding->slug))
                 consoleWatchSlugs.add(binding->slug);
@@ -1991,7 +2245,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "fx")
+    if (verb == ConsoleVerb::fx)
     {
         if (tokens.size() < 2)
         {
@@ -2012,7 +2266,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "dump")
+    if (verb == ConsoleVerb::dump)
     {
         if (tokens.size() < 2)
         {
@@ -2045,7 +2299,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "diff" && tokens.size() >= 2 && tokens[1].equalsIgnoreCase("factory"))
+    if (verb == ConsoleVerb::diffFactory && tokens.size() >= 2 && tokens[1].equalsIgnoreCase("factory"))
     {
         if (!ensureFactoryValueCache())
         {
@@ -2086,7 +2340,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "search")
+    if (verb == ConsoleVerb::search)
     {
         if (tokens.size() < 2)
         {
@@ -2140,7 +2394,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "stats")
+    if (verb == ConsoleVerb::stats)
     {
         const auto& telemetry = processor.getLiveTelemetry();
         const auto& analyzerCfg = processor.getAnalyzerRuntimeConfig();
@@ -2152,6 +2406,21 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
                   + ", param_writes=" + juce::String(static_cast<long long>(telemetry.parameterWriteCount.load())));
         lines.add("  engine_switches=" + juce::String(static_cast<long long>(telemetry.engineSwitchCount.load()))
                   + ", hq_toggles=" + juce::String(static_cast<long long>(telemetry.hqToggleCount.load())));
+        const auto latency = processor.getProcessTimeHistogram().summarise();
+        lines.add("  latency_p50_ms=" + formatConsoleValue(latency.p50Ms, 3)
+                  + ", p90=" + formatConsoleValue(latency.p90Ms, 3)
+                  + ", p99=" + formatConsoleValue(latency.p99Ms, 3)
+                  + ", p99.9=" + formatConsoleValue(latency.p999Ms, 3)
+                  + ", deadline_misses=" + juce::String(static_cast<long long>(latency.deadlineMisses)));
+        lines.add("  governor=" + juce::String(processor.isQualityGovernorEnabled()
+                                                ? choroboros::QualityGovernor::levelToToken(
+                                                      static_cast<choroboros::QualityGovernor::Level>(telemetry.governorLevel.load()))
+                                                : "off")
+                  + ", governor_load=" + formatConsoleValue(telemetry.governorLoadRatio.load(), 3)
+                  + ", governor_steps_down=" + juce::String(static_cast<long long>(telemetry.governorStepDownCount.load()))
+                  + ", governor_steps_up=" + juce::String(static_cast<long long>(telemetry.governorStepUpCount.load())));
+        lines.add("  dsp_arena=" + formatConsoleValue(static_cast<double>(processor.getDspArenaFootprintBytes()) / 1024.0, 1)
+                  + " KiB" + (processor.isDspArenaHugePageBacked() ? " (huge pages)" : ""));
         lines.add("  input_peak_l=" + formatConsoleValue(telemetry.inputPeakL.load(), 6)
                   + ", input_peak_r=" + formatConsoleValue(telemetry.inputPeakR.load(), 6));
         lines.add("  output_peak_l=" + formatConsoleValue(telemetry.outputPeakL.load(), 6)
@@ -2163,7 +2432,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "list")
+    if (verb == ConsoleVerb::list)
     {
         if (tokens.size() < 2)
         {
@@ -2330,7 +2599,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "export" && tokens.size() >= 2 && tokens[1].equalsIgnoreCase("script"))
+    if (verb == ConsoleVerb::exportScript && tokens.size() >= 2 && tokens[1].equalsIgnoreCase("script"))
     {
         std::vector<const ConsoleTargetBinding*> sorted;
         sorted.reserve(consoleTargets.size());
@@ -2361,7 +2630,7 @@ ConsoleCommandResult DevPanel::executeConsoleCommand(const juce::String& command
         return result;
     }
 
-    if (action == "import" && tokens.size() >= 2 && tokens[1].equalsIgnoreCase("script"))
+    if (verb == ConsoleVerb::importScript && tokens.size() >= 2 && tokens[1].equalsIgnoreCase("script"))
     {
         juce::String scriptText;
         const juce::String scriptArg = parsedCommand.fromFirstOccurrenceOf("import script", false, true).trim();
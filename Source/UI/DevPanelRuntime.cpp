@@ -248,7 +248,7 @@ void DevPanel::ensureTabBuilt(int mainTab)
     const int safeTab = juce::jlimit(0, 6, mainTab);
     if (rightTabBuilt[static_cast<size_t>(safeTab)])
         return;
-    if (buildContext == nullptr)
+    if (buildContext == nullptr || tabBuildDeferred)
         return;
     const double tabBuildStartMs = juce::Time::getMillisecondCounterHiRes();
 
@@ -307,6 +307,15 @@ void DevPanel::ensureCurrentTabBuilt()
     ensureTabBuilt(selectedRightTab);
 }
 
+void DevPanel::buildDeferredContent()
+{
+    if (!tabBuildDeferred)
+        return;
+    tabBuildDeferred = false;
+    updateRightTabVisibility();
+    resized();
+}
+
 void DevPanel::resized()
 {
     ensureCurrentTabBuilt();
@@ -992,6 +1001,8 @@ void DevPanel::resized()
         unlockWarningScrim.setBounds(0, 0, 0, 0);
         unlockWarningPopup.setBounds(0, 0, 0, 0);
     }
+
+    updateVirtualizedRows();
 }
 
 void DevPanel::updateActiveProfileLabel()
@@ -1594,6 +1605,29 @@ bool DevPanel::isPropertyVisibleInViewport(const juce::PropertyComponent* proper
     return propertyScreen.intersects(viewport.getScreenBounds());
 }
 
+void DevPanel::updateVirtualizedRows()
+{
+    if (lockableInputPool == nullptr)
+        return;
+
+    // Keep editors on rows within one viewport height of the visible area so scrolling stays smooth.
+    const auto keepArea = viewport.getScreenBounds().expanded(0, viewport.getHeight());
+    const bool viewportShowing = viewport.isShowing();
+    auto isNearView = [&](const LockableFloatPropertyComponent& row)
+    {
+        return viewportShowing && row.isShowing() && row.getScreenBounds().intersects(keepArea);
+    };
+
+    // Release first so rows scrolling into view can reuse the widgets just freed.
+    for (auto* row : virtualizedLockables)
+        if (row != nullptr && row->hasInputWidgets() && !row->isInputBusy() && !isNearView(*row))
+            lockableInputPool->release(row->detachInputWidgets());
+
+    for (auto* row : virtualizedLockables)
+        if (row != nullptr && !row->hasInputWidgets() && isNearView(*row))
+            row->attachInputWidgets(lockableInputPool->acquire());
+}
+
 void DevPanel::updateAnalyzerDemandFromVisibility()
 {
     auto anyVisible = [this](const juce::Array<juce::PropertyComponent*>& properties) -> bool
@@ -1632,11 +1666,13 @@ void DevPanel::updateAnalyzerDemandFromVisibility()
         return;
     }
 
+    // Acquire before releasing so a card that stays visible never drops to zero demand in between.
+    processor.acquireAnalyzerCardDemand(modulationDemand, spectrumDemand, transferDemand, telemetryDemand);
+    processor.releaseAnalyzerCardDemand(lastModulationDemand, lastSpectrumDemand, lastTransferDemand, lastTelemetryDemand);
     lastModulationDemand = modulationDemand;
     lastSpectrumDemand = spectrumDemand;
     lastTransferDemand = transferDemand;
     lastTelemetryDemand = telemetryDemand;
-    processor.setAnalyzerCardDemand(modulationDemand, spectrumDemand, transferDemand, telemetryDemand);
 }
 
 int DevPanel::refreshVisibleLiveReadouts()
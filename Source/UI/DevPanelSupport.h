@@ -1,12 +1,14 @@
 #pragma once
 
 #include "BinaryData.h"
+#include "DevPanelCommandIndex.h"
 #include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <memory>
 #include <unordered_set>
 #include <vector>
 
@@ -1133,6 +1135,10 @@ public:
     using ContextMenuHandler = std::function<void(LockableFloatPropertyComponent&, const juce::MouseEvent&)>;
     using UnlockAttemptHandler = std::function<bool(LockableFloatPropertyComponent&)>;
 
+    // Text field + stepper widgets. A row only holds these while it is near the visible part of
+    // the Dev Panel viewport; LockableInputPool recycles them between rows as the panel scrolls.
+    struct InputWidgets;
+
     LockableFloatPropertyComponent(const juce::Value& valueToControl, const juce::String& name,
                                    double min, double max, double step, double skew,
                                    const juce::String& tooltipText)
@@ -1145,58 +1151,6 @@ public:
     {
         setTooltip(tooltipText);
 
-        valueEditor.setTooltip(tooltipText);
-        valueEditor.setMultiLine(false);
-        valueEditor.setReturnKeyStartsNewLine(false);
-        valueEditor.setSelectAllWhenFocused(true);
-        valueEditor.setJustification(juce::Justification::centredRight);
-        valueEditor.setScrollbarsShown(false);
-        valueEditor.setFont(makeLabelFont(Typography::inspectorInput, false));
-        valueEditor.setBorder(juce::BorderSize<int>(2, 4, 2, 2));
-        styleHackerEditor(valueEditor);
-        valueEditor.setColour(juce::TextEditor::backgroundColourId, juce::Colour(0x00000000));
-        valueEditor.setColour(juce::TextEditor::outlineColourId, juce::Colour(0x00000000));
-        valueEditor.setColour(juce::TextEditor::focusedOutlineColourId, juce::Colour(0x00000000));
-        valueEditor.setColour(juce::TextEditor::textColourId, hackerText());
-        valueEditor.setColour(juce::TextEditor::highlightColourId, hackerBgActive().withAlpha(0.85f));
-        valueEditor.onReturnKey = [this] { commitEditorText(); };
-        valueEditor.onFocusLost = [this] { commitEditorText(); };
-        valueEditor.onEscapeKey = [this]
-        {
-            refreshEditorText();
-            valueEditor.giveAwayKeyboardFocus();
-        };
-        valueEditor.onMouseDownCallback = [this](const juce::MouseEvent& e) { return beginDrag(e); };
-        valueEditor.onMouseDragCallback = [this](const juce::MouseEvent& e) { dragAdjust(e); };
-        valueEditor.onMouseUpCallback = [this](const juce::MouseEvent& e) { endDrag(e); };
-        valueEditor.onWheelCallback = [this](const juce::MouseEvent& event, const juce::MouseWheelDetails& wheel)
-        {
-            wheelAdjust(event, wheel);
-        };
-        addAndMakeVisible(inputContainer);
-        inputContainer.addAndMakeVisible(valueEditor);
-
-        stepUpButton.setTooltip("Increase");
-        stepUpButton.setTriggeredOnMouseDown(true);
-        // Pro Tools-like autorepeat cadence: quick first nudge, then controlled hold-repeat.
-        stepUpButton.setRepeatSpeed(420, 110, 45);
-        stepUpButton.onClick = [this]
-        {
-            if (!locked)
-                nudgeBySteps(1.0 * modifierStepMultiplier(juce::ModifierKeys::getCurrentModifiersRealtime()));
-        };
-        inputContainer.addAndMakeVisible(stepUpButton);
-
-        stepDownButton.setTooltip("Decrease");
-        stepDownButton.setTriggeredOnMouseDown(true);
-        stepDownButton.setRepeatSpeed(420, 110, 45);
-        stepDownButton.onClick = [this]
-        {
-            if (!locked)
-                nudgeBySteps(-1.0 * modifierStepMultiplier(juce::ModifierKeys::getCurrentModifiersRealtime()));
-        };
-        inputContainer.addAndMakeVisible(stepDownButton);
-
         lockButton.setClickingTogglesState(true);
         lockButton.setToggleState(true, juce::dontSendNotification);
         lockButton.onClick = [this]
@@ -1223,7 +1177,7 @@ public:
     void refresh() override
     {
         currentValue = sanitizeValue(static_cast<double>(controlledValue.getValue()));
-        if (!valueEditor.hasKeyboardFocus(true) && !isDragging)
+        if (input == nullptr || (!input->editor.hasKeyboardFocus(true) && !isDragging))
             refreshEditorText();
         applyEnablement();
     }
@@ -1234,35 +1188,32 @@ public:
         refreshThemeColours();
     }
 
-    void resized() override
+    void paint(juce::Graphics& g) override
     {
-        auto content = getLookAndFeel().getPropertyComponentContentPosition(*this);
-        const int rowHeight = content.getHeight();
-        const int legacyLockSide = juce::jlimit(15, 19, rowHeight - 4);
-        const int legacyInputHeight = juce::jlimit(24, 32, rowHeight - 2);
-        // Keep input and lock at a shared mid-size to avoid oversized fields + tiny lock icons.
-        const int controlSide = juce::jlimit(21, 27, juce::roundToInt((legacyLockSide + legacyInputHeight) * 0.5f));
-        const int lockSide = juce::jmin(controlSide, juce::jmax(0, content.getWidth()));
-        auto lockBounds = content.removeFromRight(lockSide).withSizeKeepingCentre(lockSide, lockSide);
-        lockButton.setBounds(lockBounds);
-        content.removeFromRight(2);
+        juce::PropertyComponent::paint(g);
+        if (input != nullptr)
+            return;
 
-        const int availableWidth = juce::jmax(0, content.getWidth());
-        const int preferredInputWidth = juce::jlimit(52, 104, juce::roundToInt(static_cast<float>(availableWidth) * 1.00f));
-        const int inputWidth = juce::jlimit(0, availableWidth, preferredInputWidth);
-        auto inputBounds = content.removeFromLeft(inputWidth);
-        inputBounds = inputBounds.withSizeKeepingCentre(inputBounds.getWidth(), controlSide);
-        inputContainer.setBounds(inputBounds);
+        // Detached rows draw a static copy of the field, so a row scrolled in before its widgets
+        // are attached never shows up empty.
+        const auto layout = computeControlLayout();
+        if (layout.input.isEmpty())
+            return;
+        InputContainer::paintField(g, layout.input.toFloat(), !locked, layout.stepperWidth);
+        auto textArea = layout.input.reduced(1, 1);
+        textArea.removeFromRight(layout.stepperWidth);
+        textArea = textArea.withTrimmedLeft(4).withTrimmedRight(2); // matches the editor's border
+        g.setColour(hackerText());
+        g.setFont(makeLabelFont(Typography::inspectorInput, false));
+        g.drawText(formatValueText(), textArea, juce::Justification::centredRight, false);
+    }
 
-        auto inputArea = inputContainer.getLocalBounds().reduced(1, 1);
-        const int kStepperWidth = juce::jlimit(8, 10, juce::jmax(8, inputArea.getWidth() / 3));
-        inputContainer.setStepperColumnWidth(kStepperWidth);
-        auto stepperArea = inputArea.removeFromRight(kStepperWidth);
-        auto upBounds = stepperArea.removeFromTop(stepperArea.getHeight() / 2);
-        stepUpButton.setBounds(upBounds);
-        stepDownButton.setBounds(stepperArea);
-        valueEditor.setBounds(inputArea);
-        valueEditor.setFont(makeLabelFont(Typography::inspectorInput, false));
+    void resized() override
+    {
+        const auto layout = computeControlLayout();
+        lockButton.setBounds(layout.lock);
+        if (input != nullptr)
+            layoutInputWidgets(layout);
     }
 
     void setLocked(bool shouldLock)
@@ -1288,24 +1239,171 @@ public:
         applyValueFromUserInput(value);
     }
 
+    static std::unique_ptr<InputWidgets> createInputWidgets()
+    {
+        auto widgets = std::make_unique<InputWidgets>();
+        auto& editor = widgets->editor;
+        editor.setMultiLine(false);
+        editor.setReturnKeyStartsNewLine(false);
+        editor.setSelectAllWhenFocused(true);
+        editor.setJustification(juce::Justification::centredRight);
+        editor.setScrollbarsShown(false);
+        editor.setFont(makeLabelFont(Typography::inspectorInput, false));
+        editor.setBorder(juce::BorderSize<int>(2, 4, 2, 2));
+
+        widgets->stepUp.setTooltip("Increase");
+        widgets->stepUp.setTriggeredOnMouseDown(true);
+        // Pro Tools-like autorepeat cadence: quick first nudge, then controlled hold-repeat.
+        widgets->stepUp.setRepeatSpeed(420, 110, 45);
+        widgets->stepDown.setTooltip("Decrease");
+        widgets->stepDown.setTriggeredOnMouseDown(true);
+        widgets->stepDown.setRepeatSpeed(420, 110, 45);
+
+        widgets->container.addAndMakeVisible(editor);
+        widgets->container.addAndMakeVisible(widgets->stepUp);
+        widgets->container.addAndMakeVisible(widgets->stepDown);
+        return widgets;
+    }
+
+    bool hasInputWidgets() const noexcept { return input != nullptr; }
+
+    // Rows being typed into, dragged or held on a stepper keep their widgets.
+    bool isInputBusy() const
+    {
+        return input != nullptr
+            && (isDragging
+                || input->editor.hasKeyboardFocus(true)
+                || input->stepUp.isDown()
+                || input->stepDown.isDown());
+    }
+
+    void attachInputWidgets(std::unique_ptr<InputWidgets> widgets)
+    {
+        if (widgets == nullptr || input != nullptr)
+            return;
+
+        input = std::move(widgets);
+        auto& editor = input->editor;
+        editor.setTooltip(getTooltip());
+        editor.onReturnKey = [this] { commitEditorText(); };
+        editor.onFocusLost = [this] { commitEditorText(); };
+        editor.onEscapeKey = [this]
+        {
+            refreshEditorText();
+            input->editor.giveAwayKeyboardFocus();
+        };
+        editor.onMouseDownCallback = [this](const juce::MouseEvent& e) { return beginDrag(e); };
+        editor.onMouseDragCallback = [this](const juce::MouseEvent& e) { dragAdjust(e); };
+        editor.onMouseUpCallback = [this](const juce::MouseEvent& e) { endDrag(e); };
+        editor.onWheelCallback = [this](const juce::MouseEvent& event, const juce::MouseWheelDetails& wheel)
+        {
+            wheelAdjust(event, wheel);
+        };
+        input->stepUp.onClick = [this]
+        {
+            if (!locked)
+                nudgeBySteps(1.0 * modifierStepMultiplier(juce::ModifierKeys::getCurrentModifiersRealtime()));
+        };
+        input->stepDown.onClick = [this]
+        {
+            if (!locked)
+                nudgeBySteps(-1.0 * modifierStepMultiplier(juce::ModifierKeys::getCurrentModifiersRealtime()));
+        };
+
+        addAndMakeVisible(input->container);
+        refreshThemeColours();
+        applyEnablement();
+        refreshEditorText();
+        layoutInputWidgets(computeControlLayout());
+    }
+
+    std::unique_ptr<InputWidgets> detachInputWidgets()
+    {
+        if (input == nullptr)
+            return {};
+
+        // Drop callbacks first so removing the editor cannot commit into this row.
+        auto& editor = input->editor;
+        editor.onReturnKey = nullptr;
+        editor.onFocusLost = nullptr;
+        editor.onEscapeKey = nullptr;
+        editor.onMouseDownCallback = nullptr;
+        editor.onMouseDragCallback = nullptr;
+        editor.onMouseUpCallback = nullptr;
+        editor.onWheelCallback = nullptr;
+        input->stepUp.onClick = nullptr;
+        input->stepDown.onClick = nullptr;
+        removeChildComponent(&input->container);
+        repaint();
+        return std::move(input);
+    }
+
 private:
     void refreshThemeColours()
     {
-        styleHackerEditor(valueEditor);
-        valueEditor.setColour(juce::TextEditor::backgroundColourId, juce::Colour(0x00000000));
-        valueEditor.setColour(juce::TextEditor::outlineColourId, juce::Colour(0x00000000));
-        valueEditor.setColour(juce::TextEditor::focusedOutlineColourId, juce::Colour(0x00000000));
-        valueEditor.setColour(juce::TextEditor::textColourId, hackerText());
-        valueEditor.setColour(juce::TextEditor::highlightColourId, hackerBgActive().withAlpha(0.85f));
-        // TextEditor keeps existing text runs; force current value text to adopt new theme colour immediately.
-        valueEditor.applyColourToAllText(hackerText(), false);
-        valueEditor.repaint();
-        inputContainer.repaint();
-        stepUpButton.repaint();
-        stepDownButton.repaint();
+        if (input != nullptr)
+        {
+            auto& editor = input->editor;
+            styleHackerEditor(editor);
+            editor.setColour(juce::TextEditor::backgroundColourId, juce::Colour(0x00000000));
+            editor.setColour(juce::TextEditor::outlineColourId, juce::Colour(0x00000000));
+            editor.setColour(juce::TextEditor::focusedOutlineColourId, juce::Colour(0x00000000));
+            editor.setColour(juce::TextEditor::textColourId, hackerText());
+            editor.setColour(juce::TextEditor::highlightColourId, hackerBgActive().withAlpha(0.85f));
+            // TextEditor keeps existing text runs; force current value text to adopt new theme colour immediately.
+            editor.applyColourToAllText(hackerText(), false);
+            editor.repaint();
+            input->container.repaint();
+            input->stepUp.repaint();
+            input->stepDown.repaint();
+        }
         repaint();
     }
 
+    struct ControlLayout
+    {
+        juce::Rectangle<int> lock;
+        juce::Rectangle<int> input;
+        int stepperWidth = 8;
+    };
+
+    ControlLayout computeControlLayout()
+    {
+        ControlLayout layout;
+        auto content = getLookAndFeel().getPropertyComponentContentPosition(*this);
+        const int rowHeight = content.getHeight();
+        const int legacyLockSide = juce::jlimit(15, 19, rowHeight - 4);
+        const int legacyInputHeight = juce::jlimit(24, 32, rowHeight - 2);
+        // Keep input and lock at a shared mid-size to avoid oversized fields + tiny lock icons.
+        const int controlSide = juce::jlimit(21, 27, juce::roundToInt((legacyLockSide + legacyInputHeight) * 0.5f));
+        const int lockSide = juce::jmin(controlSide, juce::jmax(0, content.getWidth()));
+        layout.lock = content.removeFromRight(lockSide).withSizeKeepingCentre(lockSide, lockSide);
+        content.removeFromRight(2);
+
+        const int availableWidth = juce::jmax(0, content.getWidth());
+        const int preferredInputWidth = juce::jlimit(52, 104, juce::roundToInt(static_cast<float>(availableWidth) * 1.00f));
+        const int inputWidth = juce::jlimit(0, availableWidth, preferredInputWidth);
+        auto inputBounds = content.removeFromLeft(inputWidth);
+        layout.input = inputBounds.withSizeKeepingCentre(inputBounds.getWidth(), controlSide);
+        const int innerWidth = juce::jmax(0, layout.input.getWidth() - 2);
+        layout.stepperWidth = juce::jlimit(8, 10, juce::jmax(8, innerWidth / 3));
+        return layout;
+    }
+
+    void layoutInputWidgets(const ControlLayout& layout)
+    {
+        input->container.setBounds(layout.input);
+
+        auto inputArea = input->container.getLocalBounds().reduced(1, 1);
+        input->container.setStepperColumnWidth(layout.stepperWidth);
+        auto stepperArea = inputArea.removeFromRight(layout.stepperWidth);
+        auto upBounds = stepperArea.removeFromTop(stepperArea.getHeight() / 2);
+        input->stepUp.setBounds(upBounds);
+        input->stepDown.setBounds(stepperArea);
+        input->editor.setBounds(inputArea);
+        input->editor.setFont(makeLabelFont(Typography::inspectorInput, false));
+    }
+
     class StepArrowButton : public juce::Button
     {
     public:
@@ -1552,15 +1650,20 @@ private:
 
         void paint(juce::Graphics& g) override
         {
-            auto area = getLocalBounds().toFloat().reduced(0.5f);
-            const auto bg = enabledVisual ? hackerBgField() : hackerBgElevated();
-            const auto outline = enabledVisual ? hackerBorder() : hackerTextMuted();
+            paintField(g, getLocalBounds().toFloat(), enabledVisual, stepperColumnWidth);
+        }
+
+        static void paintField(juce::Graphics& g, juce::Rectangle<float> bounds, bool enabled, int stepperWidth)
+        {
+            auto area = bounds.reduced(0.5f);
+            const auto bg = enabled ? hackerBgField() : hackerBgElevated();
+            const auto outline = enabled ? hackerBorder() : hackerTextMuted();
             g.setColour(bg);
             g.fillRoundedRectangle(area, 2.5f);
             g.setColour(outline);
             g.drawRoundedRectangle(area, 2.5f, 1.0f);
 
-            const float dividerX = area.getRight() - static_cast<float>(stepperColumnWidth);
+            const float dividerX = area.getRight() - static_cast<float>(stepperWidth);
             g.setColour(outline.withAlpha(0.85f));
             g.drawLine(dividerX, area.getY() + 1.0f, dividerX, area.getBottom() - 1.0f, 1.0f);
             g.drawLine(dividerX, area.getCentreY(), area.getRight() - 1.0f, area.getCentreY(), 1.0f);
@@ -1709,13 +1812,13 @@ private:
 
     void commitEditorText()
     {
-        if (locked)
+        if (locked || input == nullptr)
         {
             refreshEditorText();
             return;
         }
 
-        const auto text = valueEditor.getText().trim();
+        const auto text = input->editor.getText().trim();
         if (!text.containsAnyOf("0123456789"))
         {
             refreshEditorText();
@@ -1727,16 +1830,32 @@ private:
 
     void applyEnablement()
     {
-        valueEditor.setEnabled(!locked);
-        inputContainer.setEnabledVisual(!locked);
-        stepUpButton.setEnabled(!locked);
-        stepDownButton.setEnabled(!locked);
+        if (input == nullptr)
+        {
+            repaint();
+            return;
+        }
+
+        input->editor.setEnabled(!locked);
+        input->container.setEnabledVisual(!locked);
+        input->stepUp.setEnabled(!locked);
+        input->stepDown.setEnabled(!locked);
     }
 
-    void refreshEditorText()
+    juce::String formatValueText() const
     {
         constexpr int decimals = 3;
-        valueEditor.setText(juce::String(currentValue, decimals), juce::dontSendNotification);
+        return juce::String(currentValue, decimals);
+    }
+
+    void refreshEditorText()
+    {
+        if (input == nullptr)
+        {
+            repaint();
+            return;
+        }
+        input->editor.setText(formatValueText(), juce::dontSendNotification);
     }
 
     double sanitizeValue(double value) const
@@ -1751,11 +1870,18 @@ private:
         return juce::jlimit(minValue, maxValue, snapped);
     }
 
+public:
+    struct InputWidgets
+    {
+        InputContainer container;
+        DragTextEditor editor;
+        StepArrowButton stepUp { true };
+        StepArrowButton stepDown { false };
+    };
+
+private:
     juce::Value controlledValue;
-    InputContainer inputContainer;
-    DragTextEditor valueEditor;
-    StepArrowButton stepUpButton { true };
-    StepArrowButton stepDownButton { false };
+    std::unique_ptr<InputWidgets> input;
     LockIconButton lockButton;
     double minValue = 0.0;
     double maxValue = 1.0;
@@ -1770,6 +1896,41 @@ private:
     UnlockAttemptHandler unlockAttemptHandler;
 };
 
+// Free list of LockableFloatPropertyComponent input widgets. The Dev Panel attaches widgets only to
+// rows near the viewport and hands them back here when rows scroll away, so an open panel holds
+// about two screens of text editors rather than one per control.
+class LockableInputPool
+{
+public:
+    using Widgets = std::unique_ptr<LockableFloatPropertyComponent::InputWidgets>;
+
+    Widgets acquire()
+    {
+        if (freeWidgets.empty())
+        {
+            ++numCreated;
+            return LockableFloatPropertyComponent::createInputWidgets();
+        }
+
+        auto widgets = std::move(freeWidgets.back());
+        freeWidgets.pop_back();
+        return widgets;
+    }
+
+    void release(Widgets widgets)
+    {
+        if (widgets != nullptr)
+            freeWidgets.push_back(std::move(widgets));
+    }
+
+    int getNumCreated() const noexcept { return numCreated; }
+    int getNumFree() const noexcept { return static_cast<int>(freeWidgets.size()); }
+
+private:
+    std::vector<Widgets> freeWidgets;
+    int numCreated = 0;
+};
+
 class ReadOnlyDiagnosticPropertyComponent : public juce::PropertyComponent
 {
 public:
@@ -2374,19 +2535,7 @@ public:
 
     void setAutocompleteCommands(const juce::StringArray& commands)
     {
-        autocompleteCommands.clear();
-        std::unordered_set<std::string> seenLower;
-        seenLower.reserve(static_cast<size_t>(juce::jmax(16, commands.size())));
-        for (const auto& command : commands)
-        {
-            const juce::String trimmed = command.trim();
-            if (trimmed.isEmpty())
-                continue;
-
-            const std::string key = trimmed.toLowerCase().toStdString();
-            if (seenLower.insert(key).second)
-                autocompleteCommands.add(trimmed);
-        }
+        completionIndex.rebuild(commands);
         updateAutocompleteSuggestions();
     }
 
@@ -2439,6 +2588,11 @@ public:
         refreshThemeColours();
     }
 
+    juce::StringArray getAutocompleteMatchesForTesting(const juce::String& query) const
+    {
+        return completionIndex.complete(query);
+    }
+
     ConsoleCommandResult submitCommandForTesting(const juce::String& command,
                                                  bool recordInHistory = true,
                                                  bool mirrorToConsoleOutput = false)
@@ -2601,50 +2755,14 @@ private:
         autocompleteLastQuery = query;
 
         autocompleteMatches.clear();
-        if (query.isEmpty() || autocompleteCommands.isEmpty())
+        if (query.isEmpty() || completionIndex.getNumCommands() == 0)
         {
             autocompleteLabel.setText({}, juce::dontSendNotification);
             autocompleteLabel.setVisible(false);
             return;
         }
 
-        struct Candidate
-        {
-            juce::String command;
-            int score = 0;
-        };
-
-        std::vector<Candidate> candidates;
-        candidates.reserve(static_cast<size_t>(autocompleteCommands.size()));
-        for (const auto& command : autocompleteCommands)
-        {
-            const juce::String lower = command.toLowerCase();
-            int score = -1;
-            if (lower.startsWith(query))
-                score = 0;
-            else if (lower.contains(" " + query))
-                score = 1;
-            else if (lower.contains(query))
-                score = 2;
-
-            if (score >= 0)
-                candidates.push_back({ command, score });
-        }
-
-        std::sort(candidates.begin(), candidates.end(),
-                  [](const Candidate& a, const Candidate& b)
-                  {
-                      if (a.score != b.score)
-                          return a.score < b.score;
-                      if (a.command.length() != b.command.length())
-                          return a.command.length() < b.command.length();
-                      return a.command.compareIgnoreCase(b.command) < 0;
-                  });
-
-        constexpr int kMaxAutocompleteSuggestions = 8;
-        const int visible = juce::jmin(kMaxAutocompleteSuggestions, static_cast<int>(candidates.size()));
-        for (int i = 0; i < visible; ++i)
-            autocompleteMatches.add(candidates[static_cast<size_t>(i)].command);
+        autocompleteMatches = completionIndex.complete(query);
 
         if (autocompleteMatches.isEmpty())
         {
@@ -2763,7 +2881,7 @@ private:
     HistoryTextEditor inputEditor;
     juce::StringArray outputLines;
     juce::StringArray commandHistory;
-    juce::StringArray autocompleteCommands;
+    ConsoleCompletionIndex completionIndex;
     juce::StringArray autocompleteMatches;
     juce::String autocompleteLastQuery;
     int historyCursor = -1;
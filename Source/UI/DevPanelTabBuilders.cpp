@@ -377,7 +377,7 @@ void DevPanel::buildToneTab(DevPanelBuildContext& ctx)
                                                          float displayScale = 1.0f) -> juce::PropertyComponent*
     {
         const float safeScale = juce::jmax(0.0001f, displayScale);
-        return makeLockable(
+        auto* property = makeLockable(
             makeFloatValue(
                 [this, paramId, safeScale]
                 {
@@ -404,6 +404,10 @@ void DevPanel::buildToneTab(DevPanelBuildContext& ctx)
             static_cast<double>(maxDisplay),
             static_cast<double>(stepDisplay),
             static_cast<double>(skew));
+        // Lets `sweep` hand this control to the processor's audio-thread ramp queue.
+        property->getProperties().set("consoleRampParamId", juce::String(paramId));
+        property->getProperties().set("consoleRampDisplayScale", safeScale);
+        return property;
     };
     juce::Array<juce::PropertyComponent*> toneReadouts;
     toneReadouts.add(makeReadOnly("HPF / LPF", [this]() -> juce::String
@@ -1561,6 +1565,32 @@ void DevPanel::buildValidationTab(DevPanelBuildContext& ctx)
         return juce::String(static_cast<long long>(t.engineSwitchCount.load())) + " engine, "
              + juce::String(static_cast<long long>(t.hqToggleCount.load())) + " HQ";
     }));
+    validationTelemetry.add(makeReadOnly("Block Latency", [this]() -> juce::String
+    {
+        const auto summary = processor.getProcessTimeHistogram().summarise();
+        if (summary.blocks == 0)
+            return "no blocks yet";
+        return "p50 " + juce::String(summary.p50Ms, 3) + ", p90 " + juce::String(summary.p90Ms, 3)
+             + ", p99 " + juce::String(summary.p99Ms, 3) + ", p99.9 " + juce::String(summary.p999Ms, 3) + " ms";
+    }));
+    validationTelemetry.add(makeReadOnly("Deadline Misses", [this]() -> juce::String
+    {
+        const auto summary = processor.getProcessTimeHistogram().summarise();
+        return juce::String(static_cast<long long>(summary.deadlineMisses)) + " of "
+             + juce::String(static_cast<long long>(summary.blocks)) + " blocks (> "
+             + juce::String(juce::roundToInt(summary.deadlineMissFraction * 100.0f)) + "% of deadline)";
+    }));
+    validationTelemetry.add(makeReadOnly("Quality Governor", [this]() -> juce::String
+    {
+        const auto& t = processor.getLiveTelemetry();
+        if (!processor.isQualityGovernorEnabled())
+            return "off";
+        const auto level = static_cast<choroboros::QualityGovernor::Level>(t.governorLevel.load());
+        return juce::String(choroboros::QualityGovernor::levelToToken(level)) + ", load "
+             + juce::String(t.governorLoadRatio.load() * 100.0f, 0) + "%, "
+             + juce::String(static_cast<long long>(t.governorStepDownCount.load())) + " down / "
+             + juce::String(static_cast<long long>(t.governorStepUpCount.load())) + " up";
+    }));
     validationTelemetry.add(makeReadOnly("Host Audio Config", [this]() -> juce::String
     {
         const double sr = processor.getSampleRate() > 1.0 ? processor.getSampleRate() : 0.0;
@@ -31,11 +31,16 @@ bool tryParseNumericValue(const juce::String& text, double& out)
 }
 }
 
+LabelWithContainer::LabelWithContainer()
+    : UiAnimationDriver::Client(*this)
+{
+}
+
 void LabelWithContainer::setAnimatedValueText(const juce::String& text)
 {
     if (!isValueLabelStyle || !flipAnimationEnabled || !flipHasVisualEffect)
     {
-        stopTimer();
+        stopAnimating();
         isAnimatingFlip = false;
         juce::Label::setText(text, juce::dontSendNotification);
         return;
@@ -98,7 +103,7 @@ void LabelWithContainer::setAnimatedValueText(const juce::String& text)
 
     if (flippingCharIndices.isEmpty())
     {
-        stopTimer();
+        stopAnimating();
         isAnimatingFlip = false;
         repaint();
         return;
@@ -107,7 +112,7 @@ void LabelWithContainer::setAnimatedValueText(const juce::String& text)
     isAnimatingFlip = true;
     flipProgress = 0.0f;
     flipStartTimeMs = juce::Time::getMillisecondCounterHiRes();
-    startTimerHz(60);
+    startAnimating();
     repaint();
 }
 
@@ -128,7 +133,7 @@ void LabelWithContainer::setFlipAnimationParams(bool enabled, int durationMs, fl
 
     if (!flipAnimationEnabled || !flipHasVisualEffect)
     {
-        stopTimer();
+        stopAnimating();
         isAnimatingFlip = false;
         repaint();
     }
@@ -489,21 +494,17 @@ void LabelWithContainer::paint(juce::Graphics& g)
     }
 }
 
-void LabelWithContainer::timerCallback()
+bool LabelWithContainer::advanceAnimation(double elapsedMs)
 {
+    juce::ignoreUnused(elapsedMs);
     if (!isAnimatingFlip)
-    {
-        stopTimer();
-        return;
-    }
+        return false;
 
-    const double elapsedMs = juce::Time::getMillisecondCounterHiRes() - flipStartTimeMs;
-    flipProgress = juce::jlimit(0.0f, 1.0f, static_cast<float>(elapsedMs / static_cast<double>(flipDurationMs)));
-    repaint();
+    const double flipElapsedMs = juce::Time::getMillisecondCounterHiRes() - flipStartTimeMs;
+    flipProgress = juce::jlimit(0.0f, 1.0f, static_cast<float>(flipElapsedMs / static_cast<double>(flipDurationMs)));
+    markAnimationDirty();
 
     if (flipProgress >= 1.0f)
-    {
         isAnimatingFlip = false;
-        stopTimer();
-    }
+    return isAnimatingFlip;
 }
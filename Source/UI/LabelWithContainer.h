@@ -19,11 +19,12 @@
 #pragma once
 
 #include <juce_gui_basics/juce_gui_basics.h>
+#include "UiAnimationDriver.h"
 
-class LabelWithContainer : public juce::Label, private juce::Timer
+class LabelWithContainer : public juce::Label, private UiAnimationDriver::Client
 {
 public:
-    LabelWithContainer() = default;
+    LabelWithContainer();
     ~LabelWithContainer() override = default;
     
     void paint(juce::Graphics& g) override;
@@ -102,7 +103,7 @@ private:
     juce::String flipToText;
     juce::String flipFromMappedText;
     juce::Array<int> flippingCharIndices;
-    void timerCallback() override;
+    bool advanceAnimation(double elapsedMs) override;
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LabelWithContainer)
 };
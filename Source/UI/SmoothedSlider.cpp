@@ -20,25 +20,16 @@
 #include <cmath>
 
 SmoothedSlider::SmoothedSlider(float smoothingTimeMs_, bool useExponential_)
-    : smoothingTimeMs(smoothingTimeMs_), useExponential(useExponential_)
+    : UiAnimationDriver::Client(*this),
+      smoothingTimeMs(smoothingTimeMs_), useExponential(useExponential_)
 {
     if (useExponential)
-    {
-        updateSmoothingCoeff();
         visualValueExp = getValue();
-    }
     else
-    {
-        visualValueLinear.reset(getSampleRate(), smoothingTimeMs * 0.001);
-        visualValueLinear.setCurrentAndTargetValue(getValue());
-    }
-    startTimerHz(120); // 120 FPS for smoother animation (reduced jankiness)
+        resetLinearSmoothing();
 }
 
-SmoothedSlider::~SmoothedSlider()
-{
-    stopTimer();
-}
+SmoothedSlider::~SmoothedSlider() = default;
 
 void SmoothedSlider::mouseDown(const juce::MouseEvent& e)
 {
@@ -76,61 +67,56 @@ void SmoothedSlider::mouseUp(const juce::MouseEvent& e)
 
 void SmoothedSlider::valueChanged()
 {
-    // When the actual value changes, update the target for visual smoothing
-    if (useExponential)
-    {
-        // Exponential smoothing target is set in timerCallback
-        needsRepaint = true;
-    }
-    else
-    {
+    // When the actual value changes, update the target for visual smoothing.
+    // The exponential target is read each frame in advanceAnimation().
+    if (!useExponential)
         visualValueLinear.setTargetValue(getValue());
-        needsRepaint = true;
-    }
+    needsRepaint = true;
+    startAnimating();
 }
 
-void SmoothedSlider::timerCallback()
+bool SmoothedSlider::advanceAnimation(double elapsedMs)
 {
     bool isSmoothing = false;
-    
+
     if (useExponential)
     {
-        // Exponential smoothing (one-pole filter) - matches audio smoothing
-        float target = getValue();
-        visualValueExp = visualValueExp * smoothingCoeff + target * (1.0f - smoothingCoeff);
-        // Check if still smoothing (within 0.1% of target)
+        // Exponential smoothing (one-pole filter) - matches audio smoothing; time constant = smoothingTimeMs
+        const float target = static_cast<float>(getValue());
+        const float coeff = std::exp(-static_cast<float>(elapsedMs) / juce::jmax(1.0f, smoothingTimeMs));
+        visualValueExp = visualValueExp * coeff + target * (1.0f - coeff);
+        // Still smoothing until within 0.1% of target; then land exactly on it
         isSmoothing = std::abs(visualValueExp - target) > 0.001f;
+        if (!isSmoothing)
+            visualValueExp = target;
     }
     else
     {
-        // Linear smoothing - advance by actual time delta for smoother motion
-        // At 120Hz, each frame is ~8.33ms, so we advance by 2 samples per frame
-        // This ensures smooth interpolation without jankiness
-        visualValueLinear.skip(2);
+        // Advance by real elapsed time, carrying fractional steps between frames
+        pendingLinearSteps += elapsedMs * kLinearStepsPerSecond * 0.001;
+        const int steps = static_cast<int>(pendingLinearSteps);
+        pendingLinearSteps -= steps;
+        if (steps > 0)
+            visualValueLinear.skip(steps);
         isSmoothing = visualValueLinear.isSmoothing();
     }
-    
+
     if (needsRepaint || isSmoothing)
     {
-        // Force repaint to show smoothed visual position
-        repaint();
+        markAnimationDirty();
         needsRepaint = false;
     }
+    if (!isSmoothing)
+        pendingLinearSteps = 0.0;
+    return isSmoothing;
 }
 
 void SmoothedSlider::setSmoothingTime(float timeMs)
 {
     smoothingTimeMs = timeMs;
-    
-    if (useExponential)
-    {
-        updateSmoothingCoeff();
-    }
-    else
-    {
-        visualValueLinear.reset(getSampleRate(), smoothingTimeMs * 0.001);
-        visualValueLinear.setCurrentAndTargetValue(getValue());
-    }
+
+    if (!useExponential)
+        resetLinearSmoothing();
 }
 
 void SmoothedSlider::setUseExponential(bool useExp)
@@ -138,17 +124,11 @@ void SmoothedSlider::setUseExponential(bool useExp)
     if (useExponential != useExp)
     {
         useExponential = useExp;
-        
+
         if (useExponential)
-        {
-            updateSmoothingCoeff();
             visualValueExp = getValue();
-        }
         else
-        {
-            visualValueLinear.reset(getSampleRate(), smoothingTimeMs * 0.001);
-            visualValueLinear.setCurrentAndTargetValue(getValue());
-        }
+            resetLinearSmoothing();
     }
 }
 
@@ -165,9 +145,11 @@ float SmoothedSlider::getVisualValue() const
         return visualValueLinear.getCurrentValue();
 }
 
-void SmoothedSlider::updateSmoothingCoeff()
+void SmoothedSlider::resetLinearSmoothing()
 {
-    // Calculate one-pole filter coefficient for exponential smoothing
-    // Time constant = smoothingTimeMs
-    smoothingCoeff = std::exp(-1.0f / (smoothingTimeMs * 0.001f * getSampleRate()));
+    // The old 120 Hz timer skipped two smoothing steps per tick, so linear ramps finished in half
+    // the nominal time; keep that feel now that steps follow elapsed time.
+    visualValueLinear.reset(kLinearStepsPerSecond, smoothingTimeMs * 0.0005);
+    visualValueLinear.setCurrentAndTargetValue(getValue());
+    pendingLinearSteps = 0.0;
 }
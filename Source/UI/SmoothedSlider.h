@@ -20,6 +20,7 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <juce_audio_basics/juce_audio_basics.h>
+#include "UiAnimationDriver.h"
 
 /**
  * A slider with visual smoothing for a more natural, weighted feel.
@@ -28,14 +29,13 @@
  * 
  * Supports both linear and exponential smoothing to match audio processing.
  */
-class SmoothedSlider : public juce::Slider, public juce::Timer
+class SmoothedSlider : public juce::Slider, private UiAnimationDriver::Client
 {
 public:
     SmoothedSlider(float smoothingTimeMs = 60.0f, bool useExponential = false);
     ~SmoothedSlider() override;
     
     void valueChanged() override;
-    void timerCallback() override;
     void mouseDown(const juce::MouseEvent& e) override;
     void mouseDrag(const juce::MouseEvent& e) override;
     void mouseUp(const juce::MouseEvent& e) override;
@@ -55,13 +55,15 @@ private:
     
     // Exponential smoothing (one-pole, for depth knob to match audio)
     float visualValueExp = 0.5f;
-    float smoothingCoeff = 0.0f;
     
     float smoothingTimeMs = 60.0f;
     bool useExponential = false;
     bool needsRepaint = false;
     float dragSensitivityScale = 1.0f;
-    
-    float getSampleRate() const { return 120.0f; } // 120 FPS for visual updates (smoother animation)
-    void updateSmoothingCoeff();
+    double pendingLinearSteps = 0.0;
+
+    // Linear smoothing runs in 1 ms steps so it follows wall-clock time at any display refresh rate.
+    static constexpr double kLinearStepsPerSecond = 1000.0;
+    bool advanceAnimation(double elapsedMs) override;
+    void resetLinearSmoothing();
 };
@@ -0,0 +1,109 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "SpriteBundle.h"
+#include <cstring>
+
+#if CHOROBOROS_HAS_BAKED_SPRITES
+ #include "SpriteData.h"
+#endif
+
+namespace
+{
+std::uint32_t readU32(const std::uint8_t* src) noexcept
+{
+    std::uint32_t value = 0;
+    for (int i = 0; i < 4; ++i)
+        value |= static_cast<std::uint32_t>(src[i]) << (8 * i);
+    return value;
+}
+} // namespace
+
+std::shared_ptr<const SpriteBundle> SpriteBundle::fromMemory(const void* data, std::size_t size)
+{
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    if (bytes == nullptr || size < kHeaderSize || readU32(bytes) != kMagic)
+        return nullptr;
+    if ((readU32(bytes + 4) & 0xffffu) != kVersion || (readU32(bytes + 4) >> 16) != 4u)
+        return nullptr;
+
+    const auto frameCount = readU32(bytes + 8);
+    const auto frameWidth = readU32(bytes + 12);
+    const auto frameHeight = readU32(bytes + 16);
+    const auto lineStride = static_cast<std::size_t>(readU32(bytes + 20));
+    const auto bakeScaleBits = readU32(bytes + 24);
+    const auto dataOffset = static_cast<std::size_t>(readU32(bytes + 28));
+    if (frameCount == 0 || frameWidth == 0 || frameHeight == 0 || lineStride < frameWidth * 4u
+        || dataOffset < kHeaderSize)
+        return nullptr;
+
+    const auto frameBytes = lineStride * frameHeight;
+    if (size < dataOffset || (size - dataOffset) / frameBytes < frameCount)
+        return nullptr;
+
+    std::shared_ptr<SpriteBundle> bundle(new SpriteBundle());
+    bundle->pixels = bytes + dataOffset;
+    bundle->frameCount = static_cast<int>(frameCount);
+    bundle->frameWidth = static_cast<int>(frameWidth);
+    bundle->frameHeight = static_cast<int>(frameHeight);
+    bundle->lineStride = lineStride;
+    std::memcpy(&bundle->bakeScale, &bakeScaleBits, sizeof(float));
+    bundle->frames.resize(frameCount);
+    return bundle;
+}
+
+std::shared_ptr<const SpriteBundle> SpriteBundle::findBaked(const char* resourceName)
+{
+#if CHOROBOROS_HAS_BAKED_SPRITES
+    int dataSize = 0;
+    const char* data = SpriteData::getNamedResource(resourceName, dataSize);
+    if (data == nullptr || dataSize <= 0)
+        return nullptr;
+    return fromMemory(data, static_cast<std::size_t>(dataSize));
+#else
+    juce::ignoreUnused(resourceName);
+    return nullptr;
+#endif
+}
+
+float SpriteBundle::getBakedScale()
+{
+#if CHOROBOROS_HAS_BAKED_SPRITES
+    for (int i = 0; i < SpriteData::namedResourceListSize; ++i)
+    {
+        if (const auto bundle = findBaked(SpriteData::namedResourceList[i]))
+            return bundle->getBakeScale();
+    }
+#endif
+    return 0.0f;
+}
+
+juce::Image SpriteBundle::getFrame(int index) const
+{
+    index = juce::jlimit(0, frameCount - 1, index);
+    auto& frame = frames[static_cast<size_t>(index)];
+    if (frame.isValid())
+        return frame;
+
+    frame = juce::Image(juce::Image::ARGB, frameWidth, frameHeight, false);
+    const juce::Image::BitmapData bitmap(frame, juce::Image::BitmapData::writeOnly);
+    const auto* src = pixels + static_cast<size_t>(index) * lineStride * static_cast<size_t>(frameHeight);
+    for (int y = 0; y < frameHeight; ++y)
+        std::memcpy(bitmap.getLinePointer(y), src + static_cast<size_t>(y) * lineStride, static_cast<size_t>(frameWidth) * 4u);
+    return frame;
+}
@@ -0,0 +1,67 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <juce_graphics/juce_graphics.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * Pre-sliced knob filmstrip baked at build time by Tools/SpriteBaker.
+ * Blob layout (little-endian): a 32-byte header followed by frameCount frames of
+ * premultiplied ARGB pixels in JUCE's native in-memory order, each frameHeight rows of
+ * lineStride bytes. The blob is read in place from binary data; no PNG decode happens
+ * at runtime. Frames become juce::Images on first draw (one row copy) and stay cached.
+ * Frame order matches the row-major index used by the PNG filmstrip path.
+ */
+class SpriteBundle
+{
+public:
+    static constexpr std::uint32_t kMagic = 0x50534843u; // "CHSP"
+    static constexpr std::uint16_t kVersion = 1;
+    static constexpr std::size_t kHeaderSize = 32;
+
+    // Returns nullptr if the blob is missing, truncated or from another format version.
+    static std::shared_ptr<const SpriteBundle> fromMemory(const void* data, std::size_t size);
+    // Looks up a baked bundle by resource name (e.g. "green_rate_sprites").
+    static std::shared_ptr<const SpriteBundle> findBaked(const char* resourceName);
+    // Pixel density the build baked its bundles for, or 0 when the build has none.
+    static float getBakedScale();
+
+    int getNumFrames() const noexcept { return frameCount; }
+    int getFrameWidth() const noexcept { return frameWidth; }
+    int getFrameHeight() const noexcept { return frameHeight; }
+    // Pixel density the frames were sized for (1.0 = one pixel per logical point).
+    float getBakeScale() const noexcept { return bakeScale; }
+
+    // Message thread only (frames are created lazily and cached).
+    juce::Image getFrame(int index) const;
+
+private:
+    SpriteBundle() = default;
+
+    const std::uint8_t* pixels = nullptr;
+    int frameCount = 0;
+    int frameWidth = 0;
+    int frameHeight = 0;
+    std::size_t lineStride = 0;
+    float bakeScale = 1.0f;
+    mutable std::vector<juce::Image> frames;
+};
@@ -0,0 +1,154 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ThemeAssetCache.h"
+#include "CustomLookAndFeel.h"
+#include "BinaryData.h"
+
+namespace
+{
+size_t themeSlotIndex(int colorIndex) noexcept
+{
+    return static_cast<size_t>(juce::jlimit(0, ThemeAssetCache::kNumThemes - 1, colorIndex));
+}
+
+juce::Image loadPngFromBinary(const char* data, int size)
+{
+    if (data == nullptr || size <= 0)
+        return {};
+    return juce::ImageFileFormat::loadFrom(data, static_cast<size_t>(size));
+}
+
+juce::Typeface::Ptr loadTypefaceFromBinary(const char* data, int size)
+{
+    if (data == nullptr || size <= 0)
+        return nullptr;
+    return juce::Typeface::createSystemTypefaceFor(data, static_cast<size_t>(size));
+}
+} // namespace
+
+template <typename Pack, typename DecodeFn>
+Pack ThemeAssetCache::getOrDecode(Slot<Pack>& slot, DecodeFn&& decode)
+{
+    const juce::ScopedLock lock(slot.decodeLock);
+    if (!slot.valid.load(std::memory_order_acquire))
+    {
+        slot.pack = decode();
+        slot.valid.store(true, std::memory_order_release);
+    }
+    return slot.pack;
+}
+
+ThemeAssetCache::ThemeAssetPack ThemeAssetCache::getThemePack(int colorIndex, bool useBakedSprites)
+{
+    const auto index = themeSlotIndex(colorIndex);
+    return getOrDecode(themeSlots[useBakedSprites ? 1 : 0][index], [index, useBakedSprites]
+    {
+        return CustomLookAndFeel::decodeThemeAssetPack(static_cast<int>(index), useBakedSprites);
+    });
+}
+
+bool ThemeAssetCache::hasThemePack(int colorIndex, bool useBakedSprites) const noexcept
+{
+    return themeSlots[useBakedSprites ? 1 : 0][themeSlotIndex(colorIndex)].valid.load(std::memory_order_acquire);
+}
+
+void ThemeAssetCache::storeThemePack(int colorIndex, bool useBakedSprites, const ThemeAssetPack& pack)
+{
+    auto& slot = themeSlots[useBakedSprites ? 1 : 0][themeSlotIndex(colorIndex)];
+    const juce::ScopedLock lock(slot.decodeLock);
+    if (slot.valid.load(std::memory_order_acquire))
+        return;
+    slot.pack = pack;
+    slot.valid.store(true, std::memory_order_release);
+}
+
+ThemeAssetCache::BackgroundPack ThemeAssetCache::getBackgroundPack(int colorIndex)
+{
+    const auto index = themeSlotIndex(colorIndex);
+    return getOrDecode(backgroundSlots[index], [index]
+    {
+        return decodeBackgroundPack(static_cast<int>(index));
+    });
+}
+
+juce::Typeface::Ptr ThemeAssetCache::getValueLabelTypeface()
+{
+    const juce::ScopedLock lock(typefaceLock);
+    if (valueLabelTypeface == nullptr)
+        valueLabelTypeface = loadTypefaceFromBinary(BinaryData::Technology_ttf, BinaryData::Technology_ttfSize);
+    return valueLabelTypeface;
+}
+
+juce::Typeface::Ptr ThemeAssetCache::getUiTextTypeface()
+{
+    const juce::ScopedLock lock(typefaceLock);
+    if (uiTextTypeface == nullptr)
+        uiTextTypeface = loadTypefaceFromBinary(BinaryData::Retroica_ttf, BinaryData::Retroica_ttfSize);
+    return uiTextTypeface;
+}
+
+ThemeAssetCache::BackgroundPack ThemeAssetCache::decodeBackgroundPack(int colorIndex)
+{
+    colorIndex = juce::jlimit(0, kNumThemes - 1, colorIndex);
+    const char* offName = nullptr;
+    int offSize = 0;
+    const char* onName = nullptr;
+    int onSize = 0;
+
+    if (colorIndex == 0) // Green
+    {
+        offName = BinaryData::green_light_off_backpanel_png;
+        offSize = BinaryData::green_light_off_backpanel_pngSize;
+        onName = BinaryData::green_light_on_backpanel_png;
+        onSize = BinaryData::green_light_on_backpanel_pngSize;
+    }
+    else if (colorIndex == 1) // Blue
+    {
+        offName = BinaryData::blue_light_off_backpanel_png;
+        offSize = BinaryData::blue_light_off_backpanel_pngSize;
+        onName = BinaryData::blue_light_on_backpanel_png;
+        onSize = BinaryData::blue_light_on_backpanel_pngSize;
+    }
+    else if (colorIndex == 2) // Red
+    {
+        offName = BinaryData::red_light_off_backpanel_png;
+        offSize = BinaryData::red_light_off_backpanel_pngSize;
+        onName = BinaryData::red_light_on_backpanel_png;
+        onSize = BinaryData::red_light_on_backpanel_pngSize;
+    }
+    else if (colorIndex == 3) // Purple
+    {
+        offName = BinaryData::purple_light_off_backpanel_png;
+        offSize = BinaryData::purple_light_off_backpanel_pngSize;
+        onName = BinaryData::purple_light_on_backpanel_png;
+        onSize = BinaryData::purple_light_on_backpanel_pngSize;
+    }
+    else // Black (colorIndex == 4)
+    {
+        offName = BinaryData::black_light_off_backpanel_png;
+        offSize = BinaryData::black_light_off_backpanel_pngSize;
+        onName = BinaryData::black_light_on_backpanel_png;
+        onSize = BinaryData::black_light_on_backpanel_pngSize;
+    }
+
+    BackgroundPack pack;
+    pack.off = loadPngFromBinary(offName, offSize);
+    pack.lit = loadPngFromBinary(onName, onSize);
+    return pack;
+}
@@ -0,0 +1,97 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <juce_graphics/juce_graphics.h>
+#include "SpriteBundle.h"
+#include <array>
+#include <atomic>
+#include <memory>
+
+/**
+ * Process-wide cache of decoded theme images and typefaces.
+ * Held through juce::SharedResourcePointer by every CustomLookAndFeel (and by decode threads
+ * while they run), so all open editors share one copy of each decoded, opaque-converted image
+ * and the memory is released when the last editor closes.
+ * Each slot decodes at most once: concurrent requests for the same colour wait on that slot's
+ * lock instead of decoding again, while different colours decode in parallel.
+ * Theme packs are keyed by colour and by whether build-time baked knob frames suit the display
+ * scale; packs that use baked frames skip decoding the corresponding PNG filmstrips.
+ */
+class ThemeAssetCache
+{
+public:
+    static constexpr int kNumThemes = 5; // 0=Green, 1=Blue, 2=Red, 3=Purple, 4=Black
+
+    struct ThemeAssetPack
+    {
+        juce::Image knobBaseImage;
+        juce::Image knobIndicatorImage;
+        juce::Image knobShadowOverlayImage;
+        juce::Image sliderTrackImage;
+        juce::Image sliderThumbImage;
+        juce::Image mixKnobImage;
+        juce::Image knobSpriteSheetRateImage;
+        juce::Image knobSpriteSheetDepthImage;
+        juce::Image knobSpriteSheetOffsetImage;
+        juce::Image knobSpriteSheetWidthImage;
+        juce::Image mixKnobSpriteSheetImage;
+        // Build-time baked frames; when set, the matching PNG sheet above is left undecoded.
+        std::shared_ptr<const SpriteBundle> bakedRateSheet;
+        std::shared_ptr<const SpriteBundle> bakedDepthSheet;
+        std::shared_ptr<const SpriteBundle> bakedOffsetSheet;
+        std::shared_ptr<const SpriteBundle> bakedWidthSheet;
+        std::shared_ptr<const SpriteBundle> bakedMixSheet;
+    };
+
+    struct BackgroundPack
+    {
+        juce::Image off;
+        juce::Image lit;
+    };
+
+    ThemeAssetPack getThemePack(int colorIndex, bool useBakedSprites);
+    bool hasThemePack(int colorIndex, bool useBakedSprites) const noexcept;
+    void storeThemePack(int colorIndex, bool useBakedSprites, const ThemeAssetPack& pack);
+
+    BackgroundPack getBackgroundPack(int colorIndex);
+
+    juce::Typeface::Ptr getValueLabelTypeface();
+    juce::Typeface::Ptr getUiTextTypeface();
+
+private:
+    template <typename Pack>
+    struct Slot
+    {
+        juce::CriticalSection decodeLock;
+        Pack pack;
+        std::atomic<bool> valid { false };
+    };
+
+    template <typename Pack, typename DecodeFn>
+    static Pack getOrDecode(Slot<Pack>& slot, DecodeFn&& decode);
+    static BackgroundPack decodeBackgroundPack(int colorIndex);
+
+    std::array<std::array<Slot<ThemeAssetPack>, kNumThemes>, 2> themeSlots; // [useBakedSprites][colour]
+    std::array<Slot<BackgroundPack>, kNumThemes> backgroundSlots;
+
+    juce::CriticalSection typefaceLock;
+    juce::Typeface::Ptr valueLabelTypeface;
+    juce::Typeface::Ptr uiTextTypeface;
+};
@@ -0,0 +1,199 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "UiAnimationDriver.h"
+#include <algorithm>
+
+UiAnimationDriver::Client::Client(juce::Component& animatedComponent)
+    : component(animatedComponent)
+{
+}
+
+UiAnimationDriver::Client::~Client()
+{
+    stopAnimating();
+}
+
+void UiAnimationDriver::Client::startAnimating()
+{
+    if (animating)
+        return;
+
+    animating = true;
+    lastFrameMs = juce::Time::getMillisecondCounterHiRes();
+    driver->addClient(*this);
+}
+
+void UiAnimationDriver::Client::stopAnimating()
+{
+    if (!animating)
+        return;
+
+    animating = false;
+    driver->removeClient(*this);
+}
+
+void UiAnimationDriver::Client::markAnimationDirty()
+{
+    markAnimationDirty(component.getLocalBounds());
+}
+
+void UiAnimationDriver::Client::markAnimationDirty(juce::Rectangle<int> area)
+{
+    driver->markDirty(component, area);
+}
+
+UiAnimationDriver::~UiAnimationDriver()
+{
+    cancelPendingUpdate();
+    stopTimer();
+    vblankAttachment.reset();
+}
+
+void UiAnimationDriver::markDirty(juce::Component& component, juce::Rectangle<int> area)
+{
+    if (area.isEmpty())
+        return;
+
+    if (!inFrame)
+    {
+        component.repaint(area);
+        return;
+    }
+
+    auto* topLevel = component.getTopLevelComponent();
+    const auto areaInTopLevel = topLevel->getLocalArea(&component, area);
+    for (auto& region : dirtyRegions)
+    {
+        if (region.topLevel.getComponent() == topLevel)
+        {
+            region.areas.add(areaInTopLevel);
+            return;
+        }
+    }
+
+    DirtyRegion region;
+    region.topLevel = topLevel;
+    region.areas.add(areaInTopLevel);
+    dirtyRegions.push_back(std::move(region));
+}
+
+void UiAnimationDriver::addClient(Client& client)
+{
+    if (std::find(activeClients.begin(), activeClients.end(), &client) != activeClients.end())
+        return;
+
+    activeClients.push_back(&client);
+    // The frame source must not be rebuilt from inside its own callback.
+    if (inFrame)
+        triggerAsyncUpdate();
+    else
+        updateFrameSource();
+}
+
+void UiAnimationDriver::removeClient(Client& client)
+{
+    const auto it = std::find(activeClients.begin(), activeClients.end(), &client);
+    if (it == activeClients.end())
+        return;
+
+    activeClients.erase(it);
+    if (inFrame)
+        triggerAsyncUpdate();
+    else
+        updateFrameSource();
+}
+
+void UiAnimationDriver::handleAsyncUpdate()
+{
+    updateFrameSource();
+}
+
+void UiAnimationDriver::updateFrameSource()
+{
+    if (activeClients.empty())
+    {
+        vblankAttachment.reset();
+        vblankAnchor = nullptr;
+        stopTimer();
+        return;
+    }
+
+    // Keep the current anchor while it is on screen and still hosts something animating.
+    if (auto* anchor = vblankAnchor.getComponent(); vblankAttachment != nullptr && anchor != nullptr && anchor->isOnDesktop())
+    {
+        for (const auto* client : activeClients)
+            if (client->component.getTopLevelComponent() == anchor)
+                return;
+    }
+
+    vblankAttachment.reset();
+    vblankAnchor = nullptr;
+    for (const auto* client : activeClients)
+    {
+        auto* topLevel = client->component.getTopLevelComponent();
+        if (topLevel->isOnDesktop())
+        {
+            vblankAnchor = topLevel;
+            vblankAttachment = std::make_unique<juce::VBlankAttachment>(topLevel, [this] { renderFrame(); });
+            break;
+        }
+    }
+
+    if (vblankAttachment != nullptr)
+        stopTimer();
+    else if (!isTimerRunning())
+        startTimerHz(kFallbackFrameHz);
+}
+
+void UiAnimationDriver::timerCallback()
+{
+    renderFrame();
+}
+
+void UiAnimationDriver::renderFrame()
+{
+    const double nowMs = juce::Time::getMillisecondCounterHiRes();
+    inFrame = true;
+    frameClients = activeClients;
+    for (auto* client : frameClients)
+    {
+        // A client may have stopped (or been deleted) by an earlier client's frame.
+        if (std::find(activeClients.begin(), activeClients.end(), client) == activeClients.end())
+            continue;
+
+        const double elapsedMs = juce::jlimit(0.0, kMaxFrameStepMs, nowMs - client->lastFrameMs);
+        client->lastFrameMs = nowMs;
+        if (!client->advanceAnimation(elapsedMs))
+            client->stopAnimating();
+    }
+    frameClients.clear();
+    inFrame = false;
+
+    for (auto& region : dirtyRegions)
+    {
+        auto* topLevel = region.topLevel.getComponent();
+        if (topLevel == nullptr)
+            continue;
+
+        region.areas.consolidate();
+        for (const auto& area : region.areas)
+            topLevel->repaint(area);
+    }
+    dirtyRegions.clear();
+}
@@ -0,0 +1,104 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <memory>
+#include <vector>
+
+/**
+ * Process-wide frame driver for editor animations.
+ * Held through juce::SharedResourcePointer by every animated component, so all open editors
+ * share one frame callback. Frames follow the display refresh (juce::VBlankAttachment on an
+ * on-screen editor) and fall back to a 60 Hz timer while no animated editor is on screen.
+ * Only clients with a running animation are ticked, and the frame source is torn down as soon
+ * as the last one comes to rest. Areas marked dirty during a frame are merged into one repaint
+ * per top-level window. Message thread only.
+ */
+class UiAnimationDriver : private juce::Timer,
+                          private juce::AsyncUpdater
+{
+public:
+    class Client
+    {
+    public:
+        explicit Client(juce::Component& animatedComponent);
+        virtual ~Client();
+
+        bool isAnimating() const noexcept { return animating; }
+
+    protected:
+        // Advances the animation by elapsedMs. Return false once at rest to stop receiving frames.
+        virtual bool advanceAnimation(double elapsedMs) = 0;
+
+        void startAnimating();
+        void stopAnimating();
+
+        // Queues a repaint of the owning component (or an area of it, in its own coordinates)
+        // to go out with the current frame's merged repaint.
+        void markAnimationDirty();
+        void markAnimationDirty(juce::Rectangle<int> area);
+
+    private:
+        friend class UiAnimationDriver;
+
+        juce::Component& component;
+        juce::SharedResourcePointer<UiAnimationDriver> driver;
+        double lastFrameMs = 0.0;
+        bool animating = false;
+
+        JUCE_DECLARE_NON_COPYABLE(Client)
+    };
+
+    UiAnimationDriver() = default;
+    ~UiAnimationDriver() override;
+
+    // Marks an area of any component dirty; merged into the current frame's repaint when called
+    // from inside a frame, otherwise repainted straight away.
+    void markDirty(juce::Component& component, juce::Rectangle<int> area);
+
+    int getNumAnimatingClients() const noexcept { return static_cast<int>(activeClients.size()); }
+
+private:
+    struct DirtyRegion
+    {
+        juce::Component::SafePointer<juce::Component> topLevel;
+        juce::RectangleList<int> areas;
+    };
+
+    // Longest step handed to a client, so a stalled message thread does not skip animations.
+    static constexpr double kMaxFrameStepMs = 100.0;
+    static constexpr int kFallbackFrameHz = 60;
+
+    void addClient(Client& client);
+    void removeClient(Client& client);
+    void updateFrameSource();
+    void timerCallback() override;
+    void handleAsyncUpdate() override;
+    void renderFrame();
+
+    std::vector<Client*> activeClients;
+    std::vector<Client*> frameClients;   // scratch copy, so clients may start/stop mid-frame
+    std::vector<DirtyRegion> dirtyRegions;
+    std::unique_ptr<juce::VBlankAttachment> vblankAttachment;
+    juce::Component::SafePointer<juce::Component> vblankAnchor;
+    bool inFrame = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UiAnimationDriver)
+};
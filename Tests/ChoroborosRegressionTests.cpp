@@ -3,10 +3,15 @@
  * Copyright (C) 2026 Kaizen Strategic AI Inc.
  */
 
+#include "Config/DefaultsPersistence.h"
 #include "Plugin/PluginProcessor.h"
+#include "Plugin/PluginStateCodec.h"
 #include "Plugin/PluginEditor.h"
 #include "UI/DevPanel.h"
+#include "UI/DevPanelCommandIndex.h"
 #include "UI/DevPanelSupport.h"
+#include "UI/SpriteBundle.h"
+#include "UI/UiAnimationDriver.h"
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <algorithm>
 #include <chrono>
@@ -129,11 +134,34 @@ static void testStateRoundTrip()
     const auto duplicateWarnings = proc.getDuplicateAssignmentWarnings();
     REGRESS_ASSERT(!duplicateWarnings.empty(), "Duplicate assignment warnings should report duplicates");
 
-    std::unique_ptr<juce::XmlElement> xmlState(
-        juce::AudioProcessor::getXmlFromBinary(state2.getData(), static_cast<int>(state2.getSize())));
-    REGRESS_ASSERT(xmlState != nullptr, "Failed to decode XML state for legacy fallback test");
+    REGRESS_ASSERT(state2.getSize() == PluginStateCodec::kEncodedSize,
+                   "State chunk should use the fixed-size binary layout");
+
+    // A flipped payload byte must be rejected without touching the current state.
+    juce::MemoryBlock corruptState(state2);
+    static_cast<char*>(corruptState.getData())[PluginStateCodec::kHeaderSize] ^= 0x5a;
+    const float rateBeforeCorrupt = rateParam != nullptr ? rateParam->getValue() : 0.0f;
+    proc.setStateInformation(corruptState.getData(), static_cast<int>(corruptState.getSize()));
+    REGRESS_ASSERT(rateParam == nullptr || rateParam->getValue() == rateBeforeCorrupt,
+                   "Corrupt binary state should be ignored");
+
+    // Sessions saved before the binary chunk stored an XML ValueTree with JSON core assignments.
+    std::unique_ptr<juce::XmlElement> xmlState(proc.getValueTreeState().copyState().createXml());
+    REGRESS_ASSERT(xmlState != nullptr, "Failed to build XML state for legacy fallback test");
     if (xmlState != nullptr)
     {
+        xmlState->setAttribute("modularCoresEnabled", 1);
+        xmlState->setAttribute("coreAssignmentsJson", "{\"green\":{\"nq\":\"tape\",\"hq\":\"lagrange5\"}}");
+        juce::MemoryBlock xmlWithAssignments;
+        juce::AudioProcessor::copyXmlToBinary(*xmlState, xmlWithAssignments);
+
+        ChoroborosAudioProcessor xmlProc;
+        xmlProc.prepareToPlay(44100.0, 512);
+        xmlProc.setStateInformation(xmlWithAssignments.getData(), static_cast<int>(xmlWithAssignments.getSize()));
+        REGRESS_ASSERT(xmlProc.isModularCoresEnabled(), "XML fallback should restore the modular cores flag");
+        REGRESS_ASSERT(xmlProc.getCoreAssignments().get(0, false) == choroboros::CoreId::tape,
+                       "XML fallback should restore JSON core assignments");
+
         xmlState->removeAttribute("modularCoresEnabled");
         xmlState->removeAttribute("coreAssignmentsJson");
 
@@ -165,6 +193,707 @@ static void testMaxBlockChannels()
     REGRESS_ASSERT(!hasNaNOrInf(buf), "Max block 2ch produced NaN/Inf");
 }
 
+static void testOfflineChannelParallelMatchesSerial()
+{
+    // Offline renders fan channels out to the shared worker pool; the result must be
+    // bit-identical to the serial realtime path for every parallel-capable core.
+    for (int engine = 0; engine < 5; ++engine)
+    {
+        for (int hq = 0; hq < 2; ++hq)
+        {
+            ChoroborosAudioProcessor serialProc;
+            ChoroborosAudioProcessor offlineProc;
+            offlineProc.setNonRealtime(true);
+            serialProc.prepareToPlay(48000.0, 4096);
+            offlineProc.prepareToPlay(48000.0, 4096);
+
+            for (auto* proc : { &serialProc, &offlineProc })
+            {
+                proc->getParameters()[5]->setValueNotifyingHost(static_cast<float>(engine) / 4.0f);
+                proc->getParameters()[6]->setValueNotifyingHost(hq != 0 ? 1.0f : 0.0f);
+            }
+
+            juce::Random random(0x5eed + engine * 2 + hq);
+            juce::AudioBuffer<float> serialBuf(2, 4096);
+            juce::AudioBuffer<float> offlineBuf(2, 4096);
+            juce::MidiBuffer midi;
+            bool identical = true;
+            for (int blockIndex = 0; blockIndex < 8; ++blockIndex)
+            {
+                for (int ch = 0; ch < 2; ++ch)
+                    for (int i = 0; i < serialBuf.getNumSamples(); ++i)
+                        serialBuf.setSample(ch, i, random.nextFloat() * 0.5f - 0.25f);
+                offlineBuf.makeCopyOf(serialBuf, true);
+
+                serialProc.processBlock(serialBuf, midi);
+                offlineProc.processBlock(offlineBuf, midi);
+
+                for (int ch = 0; ch < 2 && identical; ++ch)
+                    identical = std::equal(serialBuf.getReadPointer(ch),
+                                           serialBuf.getReadPointer(ch) + serialBuf.getNumSamples(),
+                                           offlineBuf.getReadPointer(ch));
+            }
+            REGRESS_ASSERT(identical, "Offline channel-parallel render diverged from serial render (engine "
+                                          << engine << ", hq " << hq << ")");
+        }
+    }
+}
+
+static void testQualityGovernorHysteresis()
+{
+    using Governor = choroboros::QualityGovernor;
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 256;
+    const double deadline = blockSize / sampleRate;
+
+    Governor governor;
+    Governor::Transition transition;
+    auto runFor = [&](double seconds, double loadRatio, int& transitions)
+    {
+        const int blocks = static_cast<int>(seconds / deadline);
+        for (int i = 0; i < blocks; ++i)
+            if (governor.update(deadline * loadRatio, blockSize, sampleRate, transition))
+                ++transitions;
+    };
+
+    int transitions = 0;
+    runFor(0.5, 0.9, transitions);
+    REGRESS_ASSERT(transitions == 1 && governor.getLevel() == Governor::Level::analyzerTapsOff,
+                   "Governor should step down once after 0.5 s over budget (got " << transitions << ")");
+
+    transitions = 0;
+    runFor(5.0, 0.6, transitions);
+    REGRESS_ASSERT(transitions == 0, "Governor must hold its level inside the hysteresis band");
+
+    transitions = 0;
+    runFor(5.0, 1.5, transitions);
+    REGRESS_ASSERT(governor.getLevel() == Governor::Level::coarseControlRate,
+                   "Governor should reach the last level under sustained overload");
+
+    transitions = 0;
+    runFor(2.0, 0.1, transitions);
+    REGRESS_ASSERT(transitions == 0, "Governor must not restore quality before the step-up hold elapses");
+    runFor(20.0, 0.1, transitions);
+    REGRESS_ASSERT(governor.getLevel() == Governor::Level::full && transitions == 3,
+                   "Governor should restore full quality one level at a time (got " << transitions << ")");
+}
+
+static void testLatencyHistogramPercentiles()
+{
+    choroboros::LatencyHistogram histogram;
+    const double deadline = 256.0 / 48000.0; // 5.33 ms
+    for (int i = 0; i < 990; ++i)
+        histogram.record(0.001, deadline);   // 1 ms
+    for (int i = 0; i < 10; ++i)
+        histogram.record(0.004, deadline);   // 4 ms, above half the deadline
+
+    auto summary = histogram.summarise();
+    REGRESS_ASSERT(summary.blocks == 1000, "Histogram should count every recorded block");
+    REGRESS_ASSERT(summary.p50Ms >= 1.0 && summary.p50Ms < 1.1, "p50 should land in the 1 ms bucket (got " << summary.p50Ms << ")");
+    REGRESS_ASSERT(summary.p99Ms >= 1.0 && summary.p99Ms < 1.1, "p99 should still be 1 ms with 1% outliers (got " << summary.p99Ms << ")");
+    REGRESS_ASSERT(summary.p999Ms >= 4.0 && summary.p999Ms < 4.4, "p99.9 should reach the 4 ms outliers (got " << summary.p999Ms << ")");
+    REGRESS_ASSERT(summary.deadlineMisses == 10, "Blocks over half the deadline should count as misses");
+
+    histogram.setDeadlineMissFraction(1.0f);
+    histogram.record(0.004, deadline);
+    histogram.record(0.004, 0.0); // offline: no deadline accounting
+    REGRESS_ASSERT(histogram.summarise().deadlineMisses == 10, "Miss threshold should follow the configured fraction");
+
+    histogram.reset();
+    summary = histogram.summarise();
+    REGRESS_ASSERT(summary.blocks == 0 && summary.deadlineMisses == 0, "Histogram reset should clear all counters");
+}
+
+static void testParameterRampsRunOnAudioThread()
+{
+    choroboros::ParameterRampQueue<2> queue;
+    REGRESS_ASSERT(queue.push({ 1, 0.0f, 1.0f, 100 }), "Ramp segment should queue");
+    REGRESS_ASSERT(!queue.anyActive(), "Ramps should only start once the audio thread drains them");
+    queue.drain();
+    REGRESS_ASSERT(std::abs(queue.valueAfter(1, 32) - 0.32f) < 1.0e-6f, "Ramp value should track the sample position");
+    queue.advance(96);
+    REGRESS_ASSERT(queue.valueAfter(1, 32) == 1.0f, "Ramp should clamp to its end value");
+    queue.advance(4);
+    REGRESS_ASSERT(!queue.anyActive() && queue.getNumActive() == 0, "Ramp should finish on its last sample");
+
+    REGRESS_ASSERT(queue.push({ 0, 0.0f, 1.0f, 100 }), "Ramp segment should queue");
+    queue.cancel(0);
+    queue.drain();
+    REGRESS_ASSERT(!queue.isActive(0), "Cancel raised after a push should stop that ramp");
+    queue.cancel(0);
+    REGRESS_ASSERT(queue.push({ 0, 0.0f, 1.0f, 100 }), "Ramp segment should queue");
+    queue.drain();
+    REGRESS_ASSERT(queue.isActive(0), "A segment pushed after a cancel should supersede it");
+
+    ChoroborosAudioProcessor proc;
+    proc.prepareToPlay(48000.0, 512);
+    juce::AudioBuffer<float> buffer(2, 512);
+    juce::MidiBuffer midi;
+    auto processBlock = [&]
+    {
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            for (int i = 0; i < buffer.getNumSamples(); ++i)
+                buffer.setSample(ch, i, 0.25f * std::sin(0.05f * static_cast<float>(i + ch)));
+        proc.processBlock(buffer, midi);
+        REGRESS_ASSERT(!hasNaNOrInf(buffer), "Ramped block produced NaN/Inf");
+    };
+
+    REGRESS_ASSERT(!proc.queueParameterRamp(ChoroborosAudioProcessor::HQ_ID, 0.0f, 1.0f, 10.0),
+                   "Only macro parameters should accept ramps");
+    REGRESS_ASSERT(proc.queueParameterRamp(ChoroborosAudioProcessor::DEPTH_ID, 0.0f, 1.0f, 10.0),
+                   "Depth ramp should queue");
+    REGRESS_ASSERT(proc.queueParameterRamp(ChoroborosAudioProcessor::RATE_ID, 0.0f, 1.0f, 2000.0),
+                   "Rate ramp should queue");
+    processBlock();
+    REGRESS_ASSERT(proc.getNumActiveParameterRamps() == 1, "10 ms ramp should finish inside one 512-sample block");
+
+    auto* rateParam = proc.getValueTreeState().getParameter(ChoroborosAudioProcessor::RATE_ID);
+    {
+        const ChoroborosAudioProcessor::ScopedRampEndWrite rampEndWrite(proc);
+        rateParam->setValueNotifyingHost(1.0f);
+    }
+    processBlock();
+    REGRESS_ASSERT(proc.getNumActiveParameterRamps() == 1, "Landing a ramp's end value should keep the ramp running");
+    rateParam->setValueNotifyingHost(0.3f);
+    processBlock();
+    REGRESS_ASSERT(proc.getNumActiveParameterRamps() == 0, "A knob or host change should stop that parameter's ramp");
+
+    REGRESS_ASSERT(proc.queueParameterRamp(ChoroborosAudioProcessor::RATE_ID, 0.0f, 1.0f, 2000.0),
+                   "Rate ramp should queue");
+    processBlock();
+    REGRESS_ASSERT(proc.getNumActiveParameterRamps() == 1, "Re-queued ramp should run");
+    proc.stopParameterRamps();
+    processBlock();
+    REGRESS_ASSERT(proc.getNumActiveParameterRamps() == 0, "Stopping ramps should clear them on the next block");
+}
+
+static void testBlockRampsMatchSmoothedValue()
+{
+    // Linear ramp toward a fixed target, filled in blocks of varying size.
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> reference;
+    choroboros::LinearBlockRamp linear;
+    reference.reset(48000.0, 0.06);
+    linear.reset(48000.0, 0.06);
+    reference.setCurrentAndTargetValue(10.0f);
+    linear.setCurrentAndTargetValue(10.0f);
+
+    std::vector<float> values(512);
+    float maxLinearError = 0.0f;
+    for (int block = 0; block < 64; ++block)
+    {
+        if (block % 5 == 0)
+        {
+            const float target = (block % 10 == 0) ? 170.0f : -90.0f;
+            reference.setTargetValue(target);
+            linear.setTargetValue(target);
+        }
+        const int numSamples = 32 + (block * 97) % 480;
+        linear.fill(values.data(), numSamples);
+        for (int i = 0; i < numSamples; ++i)
+            maxLinearError = juce::jmax(maxLinearError, std::abs(reference.getNextValue() - values[static_cast<size_t>(i)]));
+        REGRESS_ASSERT(linear.isSmoothing() == reference.isSmoothing(), "Linear block ramp should finish with SmoothedValue");
+    }
+    REGRESS_ASSERT(maxLinearError < 0.05f, "Linear block ramp drifted from SmoothedValue (max error " << maxLinearError << ")");
+    linear.skip(5000);
+    reference.skip(5000);
+    REGRESS_ASSERT(linear.getCurrentValue() == reference.getCurrentValue(), "Settled linear ramp should land on the target");
+
+    // One-pole ramp following a per-sample target that also sits clamped for stretches.
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> retargeted;
+    choroboros::OnePoleBlockRamp onePole;
+    retargeted.reset(48000.0, 0.02);
+    onePole.reset(48000.0, 0.02);
+    retargeted.setCurrentAndTargetValue(400.0f);
+    onePole.setCurrentAndTargetValue(400.0f);
+
+    std::vector<float> targets(512);
+    float phase = 0.0f;
+    float maxOnePoleError = 0.0f;
+    for (int block = 0; block < 64; ++block)
+    {
+        const int numSamples = 1 + (block * 131) % 512;
+        for (int i = 0; i < numSamples; ++i)
+        {
+            phase += 0.002f;
+            targets[static_cast<size_t>(i)] = juce::jmin(520.0f, 400.0f + 200.0f * std::sin(phase));
+        }
+        onePole.process(targets.data(), values.data(), numSamples);
+        for (int i = 0; i < numSamples; ++i)
+        {
+            retargeted.setTargetValue(targets[static_cast<size_t>(i)]);
+            maxOnePoleError = juce::jmax(maxOnePoleError, std::abs(retargeted.getNextValue() - values[static_cast<size_t>(i)]));
+        }
+    }
+    REGRESS_ASSERT(maxOnePoleError < 1.0e-3f, "One-pole block ramp drifted from per-sample SmoothedValue (max error " << maxOnePoleError << ")");
+}
+
+static void testDspArenaReprepare()
+{
+    // All delay lines and block buffers come from one arena; re-preparing at a higher rate must
+    // grow it and leave every engine producing finite output from the new block.
+    ChoroborosAudioProcessor proc;
+    proc.prepareToPlay(48000.0, 512);
+    const size_t footprint48k = proc.getDspArenaFootprintBytes();
+    REGRESS_ASSERT(footprint48k > 0, "DSP arena empty after prepareToPlay");
+    REGRESS_ASSERT(footprint48k % choroboros::DspArena::kAlignment == 0, "DSP arena footprint not cache-line padded");
+
+    proc.prepareToPlay(96000.0, 1024);
+    REGRESS_ASSERT(proc.getDspArenaFootprintBytes() > footprint48k, "DSP arena did not grow with sample rate");
+
+    juce::AudioBuffer<float> buf(2, 1024);
+    juce::MidiBuffer midi;
+    for (int engine = 0; engine < 5; ++engine)
+    {
+        for (int hq = 0; hq < 2; ++hq)
+        {
+            proc.getParameters()[5]->setValueNotifyingHost(static_cast<float>(engine) / 4.0f);
+            proc.getParameters()[6]->setValueNotifyingHost(hq != 0 ? 1.0f : 0.0f);
+            for (int ch = 0; ch < 2; ++ch)
+                for (int i = 0; i < buf.getNumSamples(); ++i)
+                    buf.setSample(ch, i, std::sin(static_cast<float>(i) * 0.05f) * 0.5f);
+            proc.processBlock(buf, midi);
+            REGRESS_ASSERT(!hasNaNOrInf(buf), "NaN/Inf after arena re-prepare (engine " << engine << ", hq " << hq << ")");
+        }
+    }
+}
+
+static void testSharedHistoryCoreSwitchSkipsWarmup()
+{
+    // Blue NQ/HQ (Cubic/Thiran) read the shared input history, so a quality toggle is promoted
+    // on the very next block. Red NQ (BBD) keeps a private delay line and still warms up.
+    ChoroborosAudioProcessor proc;
+    proc.prepareToPlay(48000.0, 256);
+    juce::AudioBuffer<float> buf(2, 256);
+    juce::MidiBuffer midi;
+    juce::Random random(0x4157);
+    const auto runBlocks = [&](int numBlocks)
+    {
+        for (int blockIndex = 0; blockIndex < numBlocks; ++blockIndex)
+        {
+            for (int ch = 0; ch < 2; ++ch)
+                for (int i = 0; i < buf.getNumSamples(); ++i)
+                    buf.setSample(ch, i, random.nextFloat() * 0.5f - 0.25f);
+            proc.processBlock(buf, midi);
+            REGRESS_ASSERT(!hasNaNOrInf(buf), "Core switch produced NaN/Inf");
+        }
+    };
+
+    proc.getParameters()[5]->setValueNotifyingHost(1.0f / 4.0f);
+    proc.getParameters()[6]->setValueNotifyingHost(0.0f);
+    runBlocks(64); // settle any switch and crossfade from the default engine
+
+    proc.getParameters()[6]->setValueNotifyingHost(1.0f);
+    runBlocks(1);
+    REGRESS_ASSERT(!proc.isCoreSwitchPending(), "Shared-history core switch still warming up after one block");
+
+    runBlocks(64);
+    proc.getParameters()[5]->setValueNotifyingHost(2.0f / 4.0f);
+    proc.getParameters()[6]->setValueNotifyingHost(0.0f);
+    runBlocks(1);
+    REGRESS_ASSERT(proc.isCoreSwitchPending(), "Private-delay core switch skipped its warmup");
+    runBlocks(64);
+    REGRESS_ASSERT(!proc.isCoreSwitchPending(), "Private-delay core switch never completed");
+}
+
+static void testDspTablesSharedAcrossInstances()
+{
+    // Sinc kernels and the core-switch curve are built once per process; a second instance
+    // must reuse them instead of building (or storing) its own copies.
+    juce::SharedResourcePointer<choroboros::DspTableRegistry> registry;
+    ChoroborosAudioProcessor first;
+    first.prepareToPlay(48000.0, 512);
+    const int buildsAfterFirst = registry->getNumBuilds();
+    const int tablesAfterFirst = registry->getNumTables();
+    REGRESS_ASSERT(buildsAfterFirst > 0 && buildsAfterFirst == tablesAfterFirst,
+                   "Each DSP table should be built exactly once (builds " << buildsAfterFirst << ", tables " << tablesAfterFirst << ")");
+
+    ChoroborosAudioProcessor second;
+    second.prepareToPlay(96000.0, 256);
+    REGRESS_ASSERT(registry->getNumBuilds() == buildsAfterFirst,
+                   "Second instance rebuilt shared DSP tables (" << registry->getNumBuilds() << " builds)");
+
+    juce::AudioBuffer<float> buf(2, 256);
+    juce::MidiBuffer midi;
+    second.getParameters()[5]->setValueNotifyingHost(1.0f / 4.0f);
+    second.getParameters()[6]->setValueNotifyingHost(1.0f); // Blue HQ = Thiran
+    for (int blockIndex = 0; blockIndex < 32; ++blockIndex)
+    {
+        for (int ch = 0; ch < 2; ++ch)
+            for (int i = 0; i < buf.getNumSamples(); ++i)
+                buf.setSample(ch, i, std::sin(static_cast<float>(blockIndex * 256 + i) * 0.03f) * 0.5f);
+        second.processBlock(buf, midi);
+        REGRESS_ASSERT(!hasNaNOrInf(buf), "Shared-table instance produced NaN/Inf");
+    }
+}
+
+static void testSurroundBedLfoSpread()
+{
+    // A 7.1.4 bed runs in one instance: five width pairs, and channels fed identical input
+    // come out different because each pair gets its own LFO phase.
+    ChoroborosAudioProcessor proc;
+    const auto bed = juce::AudioChannelSet::create7point1point4();
+    juce::AudioProcessor::BusesLayout layout;
+    layout.inputBuses.add(bed);
+    layout.outputBuses.add(bed);
+    REGRESS_ASSERT(proc.checkBusesLayoutSupported(layout), "7.1.4 bed layout rejected");
+    juce::AudioProcessor::BusesLayout mismatched;
+    mismatched.inputBuses.add(juce::AudioChannelSet::stereo());
+    mismatched.outputBuses.add(juce::AudioChannelSet::create5point1());
+    REGRESS_ASSERT(!proc.checkBusesLayoutSupported(mismatched), "Stereo-in / 5.1-out layout should be rejected");
+    REGRESS_ASSERT(proc.setBusesLayout(layout), "Could not switch processor to a 7.1.4 bed");
+
+    proc.prepareToPlay(48000.0, 256);
+    REGRESS_ASSERT(proc.getNumWidthPairs() == 5, "7.1.4 bed should have 5 width pairs, got " << proc.getNumWidthPairs());
+
+    const int numChannels = bed.size();
+    const int leftSide = bed.getChannelIndexForType(juce::AudioChannelSet::leftSurroundSide);
+    const int leftRear = bed.getChannelIndexForType(juce::AudioChannelSet::leftSurroundRear);
+    const int topFrontLeft = bed.getChannelIndexForType(juce::AudioChannelSet::topFrontLeft);
+    juce::AudioBuffer<float> buf(numChannels, 256);
+    juce::MidiBuffer midi;
+    juce::Random random(0x714);
+    double sideVsRear = 0.0;
+    double sideVsTop = 0.0;
+    for (int blockIndex = 0; blockIndex < 64; ++blockIndex)
+    {
+        for (int i = 0; i < buf.getNumSamples(); ++i)
+        {
+            const float sample = random.nextFloat() * 0.5f - 0.25f;
+            for (int ch = 0; ch < numChannels; ++ch)
+                buf.setSample(ch, i, sample);
+        }
+        proc.processBlock(buf, midi);
+        REGRESS_ASSERT(!hasNaNOrInf(buf), "Surround bed produced NaN/Inf");
+        for (int i = 0; i < buf.getNumSamples(); ++i)
+        {
+            sideVsRear += std::abs(buf.getSample(leftSide, i) - buf.getSample(leftRear, i));
+            sideVsTop += std::abs(buf.getSample(leftSide, i) - buf.getSample(topFrontLeft, i));
+        }
+    }
+    REGRESS_ASSERT(sideVsRear > 1.0 && sideVsTop > 1.0,
+                   "Surround pairs not decorrelated (side/rear " << sideVsRear << ", side/top " << sideVsTop << ")");
+}
+
+static void testSpreadLfosFollowOffsetRamp()
+{
+    // Two pairs split the cycle, so the second pair's R LFO is the first pair's R shifted by pi.
+    // That holds sample by sample while the offset ramps, not just at chunk boundaries.
+    ChorusDSP dsp;
+    dsp.setChannelPairs({ { 2, 3 } });
+    dsp.prepare({ 48000.0, 512, 4 });
+    dsp.setOffset(0.0f);
+    juce::AudioBuffer<float> buf(4, 512);
+    const auto runBlock = [&]
+    {
+        for (int ch = 0; ch < 4; ++ch)
+            for (int i = 0; i < buf.getNumSamples(); ++i)
+                buf.setSample(ch, i, 0.25f * std::sin(0.01f * static_cast<float>(i)));
+        juce::dsp::AudioBlock<float> block(buf);
+        dsp.process(block);
+    };
+    runBlock();
+    dsp.setOffset(180.0f);
+    float maxError = 0.0f;
+    for (int blockIndex = 0; blockIndex < 4; ++blockIndex)
+    {
+        runBlock();
+        const float* right = dsp.getChannelLfo(1);
+        const float* rearRight = dsp.getChannelLfo(3);
+        for (int i = 0; i < buf.getNumSamples(); ++i)
+            maxError = juce::jmax(maxError, std::abs(rearRight[i] + right[i]));
+    }
+    REGRESS_ASSERT(maxError < 1.0e-4f, "Surround R LFO drifted from the ramping offset (max error " << maxError << ")");
+}
+
+static void testApproxBbdMatchesStageModelSpectrum()
+{
+    // Calibration for the approximated BBD: Red NQ fully wet on identical noise, once through the
+    // stage model and once through bbd_approx. Third-octave band levels must agree within a few dB
+    // wherever the stage model passes meaningful signal (measured worst band: 0.22 dB, at 6.4 kHz).
+    constexpr int blockSize = 512;
+    constexpr int fftOrder = 11;
+    constexpr int fftSize = 1 << fftOrder;
+    ChoroborosAudioProcessor stage;
+    ChoroborosAudioProcessor approx;
+    approx.setModularCoresEnabled(true);
+    approx.setCoreAssignment(2, false, choroboros::CoreId::bbd_approx);
+    for (auto* proc : { &stage, &approx })
+    {
+        proc->prepareToPlay(48000.0, blockSize);
+        proc->getParameters()[5]->setValueNotifyingHost(2.0f / 4.0f); // Red
+        proc->getParameters()[6]->setValueNotifyingHost(0.0f);        // NQ
+        proc->getParameters()[7]->setValueNotifyingHost(1.0f);        // Fully wet
+    }
+
+    juce::dsp::FFT fft(fftOrder);
+    std::vector<float> window(static_cast<size_t>(fftSize));
+    for (int i = 0; i < fftSize; ++i)
+        window[static_cast<size_t>(i)] = 0.5f - 0.5f * std::cos(juce::MathConstants<float>::twoPi * static_cast<float>(i) / static_cast<float>(fftSize));
+    std::vector<float> fftData(static_cast<size_t>(fftSize * 2));
+    std::vector<double> stagePower(static_cast<size_t>(fftSize / 2 + 1), 0.0);
+    std::vector<double> approxPower(stagePower.size(), 0.0);
+    const auto accumulate = [&](const juce::AudioBuffer<float>& capture, std::vector<double>& power)
+    {
+        for (int frame = 0; frame + fftSize <= capture.getNumSamples(); frame += fftSize / 2)
+        {
+            std::fill(fftData.begin(), fftData.end(), 0.0f);
+            for (int i = 0; i < fftSize; ++i)
+                fftData[static_cast<size_t>(i)] = capture.getSample(0, frame + i) * window[static_cast<size_t>(i)];
+            fft.performFrequencyOnlyForwardTransform(fftData.data());
+            for (size_t bin = 0; bin < power.size(); ++bin)
+                power[bin] += static_cast<double>(fftData[bin]) * static_cast<double>(fftData[bin]);
+        }
+    };
+
+    const int warmupBlocks = 96;  // ~1 s: core switch, crossfade and smoothers settle
+    const int captureBlocks = 192;
+    juce::AudioBuffer<float> stageBuf(2, blockSize);
+    juce::AudioBuffer<float> approxBuf(2, blockSize);
+    juce::AudioBuffer<float> stageCapture(1, captureBlocks * blockSize);
+    juce::AudioBuffer<float> approxCapture(1, captureBlocks * blockSize);
+    juce::MidiBuffer midi;
+    juce::Random random(0xBBDF);
+    for (int blockIndex = 0; blockIndex < warmupBlocks + captureBlocks; ++blockIndex)
+    {
+        for (int ch = 0; ch < 2; ++ch)
+            for (int i = 0; i < blockSize; ++i)
+                stageBuf.setSample(ch, i, random.nextFloat() * 0.5f - 0.25f);
+        approxBuf.makeCopyOf(stageBuf, true);
+        stage.processBlock(stageBuf, midi);
+        approx.processBlock(approxBuf, midi);
+        REGRESS_ASSERT(!hasNaNOrInf(approxBuf), "Approximated BBD produced NaN/Inf");
+        if (blockIndex < warmupBlocks)
+            continue;
+        const int offset = (blockIndex - warmupBlocks) * blockSize;
+        stageCapture.copyFrom(0, offset, stageBuf, 0, 0, blockSize);
+        approxCapture.copyFrom(0, offset, approxBuf, 0, 0, blockSize);
+    }
+    REGRESS_ASSERT(!approx.isCoreSwitchPending(), "Approximated BBD core switch never completed");
+    accumulate(stageCapture, stagePower);
+    accumulate(approxCapture, approxPower);
+
+    const double binHz = 48000.0 / fftSize;
+    std::vector<double> stageBandsDb;
+    std::vector<double> approxBandsDb;
+    for (double lowHz = 100.0; lowHz * std::pow(2.0, 1.0 / 3.0) < 20000.0; lowHz *= std::pow(2.0, 1.0 / 3.0))
+    {
+        const auto firstBin = static_cast<size_t>(std::ceil(lowHz / binHz));
+        const auto lastBin = static_cast<size_t>(lowHz * std::pow(2.0, 1.0 / 3.0) / binHz);
+        double stageSum = 1.0e-20;
+        double approxSum = 1.0e-20;
+        for (size_t bin = firstBin; bin <= lastBin && bin < stagePower.size(); ++bin)
+        {
+            stageSum += stagePower[bin];
+            approxSum += approxPower[bin];
+        }
+        stageBandsDb.push_back(10.0 * std::log10(stageSum));
+        approxBandsDb.push_back(10.0 * std::log10(approxSum));
+    }
+
+    const double peakDb = *std::max_element(stageBandsDb.begin(), stageBandsDb.end());
+    double worstErrorDb = 0.0;
+    for (size_t band = 0; band < stageBandsDb.size(); ++band)
+        if (stageBandsDb[band] > peakDb - 20.0)
+            worstErrorDb = juce::jmax(worstErrorDb, std::abs(approxBandsDb[band] - stageBandsDb[band]));
+    REGRESS_ASSERT(worstErrorDb < 3.0,
+                   "Approximated BBD spectrum deviates from the stage model by " << worstErrorDb << " dB in a third-octave band");
+}
+
+static void testApproxBbdCheaperAcrossClockRange()
+{
+    // The approximated BBD exists to save CPU in dense sessions, so it has to beat the stage model
+    // at every clock rate, not just the default. Red NQ fully wet, identical input, blocks timed
+    // interleaved so both cores see the same machine load; medians keep scheduler noise out.
+    using Clock = std::chrono::steady_clock;
+    constexpr int blockSize = 512;
+    constexpr int warmupBlocks = 200;
+    constexpr int timedBlocks = 2000;
+    juce::AudioBuffer<float> source(2, blockSize);
+    juce::Random random(0xBBDC);
+    for (int ch = 0; ch < 2; ++ch)
+        for (int i = 0; i < blockSize; ++i)
+            source.setSample(ch, i, random.nextFloat() * 0.5f - 0.25f);
+
+    std::cout << "Approximated BBD vs stage model, median us per " << blockSize << "-sample stereo block\n";
+    for (const float stages : { 256.0f, 512.0f, 1024.0f, 2048.0f })
+    {
+        ChorusDSP stage;
+        ChorusDSP approx;
+        approx.setModularCoreModeEnabled(true);
+        approx.setCoreAssignment(2, false, choroboros::CoreId::bbd_approx);
+        for (auto* dsp : { &stage, &approx })
+        {
+            dsp->getRuntimeTuning().bbdStages.store(stages);
+            dsp->prepare({ 48000.0, static_cast<juce::uint32>(blockSize), 2 });
+            dsp->setEngineColor(2); // Red
+            dsp->setQualityEnabled(false);
+            dsp->setMix(1.0f);
+        }
+
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        const auto timeBlock = [&](ChorusDSP& dsp)
+        {
+            buffer.makeCopyOf(source, true);
+            juce::dsp::AudioBlock<float> block(buffer);
+            const auto start = Clock::now();
+            dsp.process(block);
+            return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        };
+        for (int i = 0; i < warmupBlocks; ++i)
+        {
+            timeBlock(stage);
+            timeBlock(approx);
+        }
+        std::vector<double> stageUs;
+        std::vector<double> approxUs;
+        for (int i = 0; i < timedBlocks; ++i)
+        {
+            stageUs.push_back(timeBlock(stage));
+            approxUs.push_back(timeBlock(approx));
+        }
+        const auto median = [](std::vector<double>& v)
+        {
+            std::nth_element(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(v.size() / 2), v.end());
+            return v[v.size() / 2];
+        };
+        const double stageMedian = median(stageUs);
+        const double approxMedian = median(approxUs);
+        std::cout << "  bbdStages " << stages << ": stage " << stageMedian << ", approx " << approxMedian << "\n";
+        REGRESS_ASSERT(approx.getCurrentResolvedCoreId() == choroboros::CoreId::bbd_approx,
+                       "Approximated BBD was not the active core at bbdStages " << stages);
+        REGRESS_ASSERT(approxMedian < stageMedian,
+                       "Approximated BBD is not cheaper than the stage model at bbdStages " << stages
+                       << " (" << approxMedian << " us vs " << stageMedian << " us)");
+    }
+}
+
+static void testAnalyzerDemandReferenceCounting()
+{
+    ChoroborosAudioProcessor proc;
+    proc.prepareToPlay(48000.0, 512);
+    const auto& flags = proc.getDiagnosticFeatureFlags();
+    REGRESS_ASSERT(!flags.spectrumCardEnabled.load() && !flags.telemetryCardEnabled.load(),
+                   "Analyzer cards must start without demand when no editor is attached");
+
+    // Two editors showing the spectrum card; closing one must keep it live.
+    proc.acquireAnalyzerCardDemand(false, true, false, false);
+    proc.acquireAnalyzerCardDemand(false, true, false, true);
+    proc.releaseAnalyzerCardDemand(false, true, false, true);
+    REGRESS_ASSERT(flags.spectrumCardEnabled.load() && !flags.telemetryCardEnabled.load(),
+                   "Analyzer demand should stay active while any consumer still holds it");
+    proc.releaseAnalyzerCardDemand(false, true, false, false);
+    REGRESS_ASSERT(!flags.spectrumCardEnabled.load(), "Analyzer demand should drop once the last consumer releases");
+    proc.releaseResources();
+}
+
+static void testParsedDefaultsCacheShared()
+{
+    // Runs against a scratch file so the cache is exercised whether or not user defaults exist.
+    const auto file = juce::File::createTempFile(".json");
+    const auto rateOf = [](const DefaultsPersistence::ParsedDocument& document)
+    {
+        return document != nullptr ? static_cast<double>((*document)["rate"]) : -1.0;
+    };
+
+    REGRESS_ASSERT(file.replaceWithText("{\"rate\": 0.5}"), "Could not write scratch defaults file");
+    const auto first = DefaultsPersistence::loadParsedFrom(file);
+    const auto second = DefaultsPersistence::loadParsedFrom(file);
+    REGRESS_ASSERT(first != nullptr && rateOf(first) == 0.5, "Scratch defaults file did not parse");
+    REGRESS_ASSERT(first == second, "Unchanged defaults file should be served from the shared parsed cache");
+
+    // Written within the same second, so only the size tells the cache the file changed.
+    REGRESS_ASSERT(file.replaceWithText("{\"rate\": 0.75, \"depth\": 0.5}"), "Could not rewrite scratch defaults file");
+    const auto resized = DefaultsPersistence::loadParsedFrom(file);
+    REGRESS_ASSERT(resized != first && rateOf(resized) == 0.75, "Size change should invalidate the parsed cache");
+
+    // Same size, newer mtime.
+    REGRESS_ASSERT(file.replaceWithText("{\"rate\": 0.25, \"depth\": 0.5}"), "Could not rewrite scratch defaults file");
+    file.setLastModificationTime(juce::Time::getCurrentTime() + juce::RelativeTime::seconds(10.0));
+    const auto touched = DefaultsPersistence::loadParsedFrom(file);
+    REGRESS_ASSERT(touched != resized && rateOf(touched) == 0.25, "Modification time change should invalidate the parsed cache");
+    REGRESS_ASSERT(DefaultsPersistence::loadParsedFrom(file) == touched, "Re-cached document should be shared again");
+
+    DefaultsPersistence::invalidateParsedCache();
+    const auto reparsed = DefaultsPersistence::loadParsedFrom(file);
+    REGRESS_ASSERT(reparsed != nullptr && reparsed != touched, "Invalidation should force a fresh parse");
+    REGRESS_ASSERT(juce::JSON::toString(*reparsed) == juce::JSON::toString(*touched),
+                   "Re-parsed defaults should match the cached document");
+
+    file.deleteFile();
+    DefaultsPersistence::invalidateParsedCache();
+}
+
+static void testSpriteBundleLayout()
+{
+    // Two 3x2 frames, rows padded to a 16-byte stride, built the way Tools/SpriteBaker writes them.
+    constexpr int frameWidth = 3;
+    constexpr int frameHeight = 2;
+    constexpr int lineStride = 16;
+    constexpr int numFrames = 2;
+    juce::MemoryOutputStream blob;
+    blob.writeInt(static_cast<int>(SpriteBundle::kMagic));
+    blob.writeInt(static_cast<int>(SpriteBundle::kVersion | (4u << 16)));
+    blob.writeInt(numFrames);
+    blob.writeInt(frameWidth);
+    blob.writeInt(frameHeight);
+    blob.writeInt(lineStride);
+    blob.writeFloat(1.0f);
+    blob.writeInt(static_cast<int>(SpriteBundle::kHeaderSize));
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        for (int y = 0; y < frameHeight; ++y)
+        {
+            juce::PixelARGB row[4] {};
+            for (int x = 0; x < frameWidth; ++x)
+                row[x] = juce::PixelARGB(255, static_cast<juce::uint8>(frame * 100 + y * 10 + x), 0, 0);
+            blob.write(row, lineStride);
+        }
+    }
+
+    const auto bundle = SpriteBundle::fromMemory(blob.getData(), blob.getDataSize());
+    REGRESS_ASSERT(bundle != nullptr && bundle->getNumFrames() == numFrames, "Sprite bundle header should parse");
+    if (bundle != nullptr)
+    {
+        const auto frame = bundle->getFrame(1);
+        REGRESS_ASSERT(frame.getWidth() == frameWidth && frame.getHeight() == frameHeight,
+                       "Sprite bundle frame has wrong dimensions");
+        REGRESS_ASSERT(frame.getPixelAt(2, 1).getRed() == 112, "Sprite bundle frame pixels are misaddressed");
+    }
+    REGRESS_ASSERT(SpriteBundle::fromMemory(blob.getData(), blob.getDataSize() - 1) == nullptr,
+                   "Truncated sprite bundle should be rejected");
+}
+
+static void testConsoleCompletionIndexRanking()
+{
+    juce::StringArray commands { "get rate", "Reset rate", "set rate", "set rate_smoothing_ms", "watch rate",
+                                 "set depth", "macro rate", "unwatch rate", "set RATE" };
+    for (int i = 0; i < 4000; ++i)
+        commands.add("set target_" + juce::String(i));
+
+    devpanel::ConsoleCompletionIndex index;
+    index.rebuild(commands);
+    REGRESS_ASSERT(index.getNumCommands() == commands.size() - 1, "Completion index should drop case-insensitive duplicates");
+
+    const auto rateMatches = index.complete("rate");
+    REGRESS_ASSERT(rateMatches.size() == 7, "`rate` should match seven commands");
+    REGRESS_ASSERT(rateMatches[0] == "get rate" && rateMatches[1] == "set rate",
+                   "Word matches should rank shortest first, then alphabetically");
+    REGRESS_ASSERT(rateMatches[6] == "set rate_smoothing_ms", "Longer word matches should rank last");
+
+    const auto setMatches = index.complete("set r");
+    REGRESS_ASSERT(setMatches.size() == 3 && setMatches[0] == "set rate", "Command prefix should resolve through the trie");
+    REGRESS_ASSERT(setMatches[2] == "Reset rate", "Substring matches should rank after prefix matches");
+    REGRESS_ASSERT(index.complete("set target_").size() == devpanel::ConsoleCompletionIndex::kMaxResults,
+                   "Completion should cap results");
+    REGRESS_ASSERT(index.complete("zzz").isEmpty(), "Unknown query should not complete");
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 4000; ++i)
+        index.complete("set target_" + juce::String(i % 400));
+    const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    REGRESS_ASSERT(elapsedMs <= 40.0, "4000 indexed completions exceeded 40ms");
+}
+
 static devpanel::CommandConsolePropertyComponent* findConsoleComponentRecursive(juce::Component& root)
 {
     if (auto* console = dynamic_cast<devpanel::CommandConsolePropertyComponent*>(&root))
@@ -259,6 +988,69 @@ static juce::String parseFirstSlugFromListOutput(const juce::String& output)
     return {};
 }
 
+static void testAnimationDriverIdlesAtRest()
+{
+    juce::SharedResourcePointer<UiAnimationDriver> driver;
+    const int baseline = driver->getNumAnimatingClients();
+    {
+        SmoothedSlider slider;
+        slider.setRange(0.0, 1.0);
+        REGRESS_ASSERT(driver->getNumAnimatingClients() == baseline, "Idle slider should not be animating");
+        slider.setValue(0.75, juce::sendNotificationSync);
+        REGRESS_ASSERT(driver->getNumAnimatingClients() == baseline + 1, "Value change should start the slider's animation");
+
+        LabelWithContainer label;
+        label.setValueLabelStyle(true);
+        label.setAnimatedValueText("1.00");
+        label.setAnimatedValueText("2.00");
+        REGRESS_ASSERT(driver->getNumAnimatingClients() == baseline + 2, "Digit flip should start the label's animation");
+    }
+    REGRESS_ASSERT(driver->getNumAnimatingClients() == baseline, "Destroyed components should leave the animation driver");
+}
+
+static void testDevPanelRowRecycling()
+{
+    juce::Value value(0.25);
+    devpanel::LockableFloatPropertyComponent first(value, "First", 0.0, 1.0, 0.01, 1.0, {});
+    devpanel::LockableFloatPropertyComponent second(value, "Second", 0.0, 1.0, 0.01, 1.0, {});
+    devpanel::LockableInputPool pool;
+    REGRESS_ASSERT(!first.hasInputWidgets() && !second.hasInputWidgets(), "Rows should start without input widgets");
+
+    first.setValueFromCommand(0.5);
+    REGRESS_ASSERT(std::abs(static_cast<double>(value.getValue()) - 0.5) < 1.0e-9, "Detached row should still accept console values");
+
+    first.attachInputWidgets(pool.acquire());
+    REGRESS_ASSERT(first.hasInputWidgets(), "Acquired widgets should attach to the row");
+    pool.release(first.detachInputWidgets());
+    second.attachInputWidgets(pool.acquire());
+    REGRESS_ASSERT(second.hasInputWidgets() && !first.hasInputWidgets(), "Widgets should move between rows");
+    REGRESS_ASSERT(pool.getNumCreated() == 1 && pool.getNumFree() == 0, "Pool should reuse released widgets");
+}
+
+static void testConsoleAutocompleteDocMatchesBuilder(bool rewriteDoc)
+{
+    ChoroborosAudioProcessor proc;
+    proc.prepareToPlay(48000.0, 256);
+    ChoroborosPluginEditor editor(proc);
+    DevPanel devPanel(editor, proc);
+
+    const juce::String generated = devPanel.buildConsoleAutocompleteJson();
+    // Targets from tabs that are only built on demand must be listed too.
+    for (const char* expected : { "\"governor on\"", "\"latency export\"", "\"slot set red nq bbd_approx\"",
+                                  "\"set black_hq_tap2_depth_base\"", "\"sweep tape_hermite_tension\"" })
+        REGRESS_ASSERT(generated.contains(expected), "Autocomplete list is missing " << expected);
+
+    const juce::File doc = juce::File(CHOROBOROS_SOURCE_DIR).getChildFile("docs/CONSOLE_AUTOCOMPLETE.json");
+    if (rewriteDoc)
+    {
+        REGRESS_ASSERT(doc.replaceWithText(generated, false, false, "\n"), "Could not write " << doc.getFullPathName());
+        std::cout << "Wrote " << doc.getFullPathName() << "\n";
+        return;
+    }
+    REGRESS_ASSERT(doc.loadFileAsString().replace("\r\n", "\n") == generated,
+                   "docs/CONSOLE_AUTOCOMPLETE.json is stale; rerun with --write-autocomplete-json");
+}
+
 static void testConsoleCommandLatencyUnderAudioLoad()
 {
     using Clock = std::chrono::steady_clock;
@@ -481,15 +1273,54 @@ static void testConsoleCommandLatencyUnderAudioLoad()
         return 0.0;
     };
 
-    REGRESS_ASSERT(warmP95For("set") <= 90.0, "Warm p95 for `set` exceeded 90ms");
+    REGRESS_ASSERT(warmP95For("set") <= 20.0, "Warm p95 for `set` exceeded 20ms");
+    REGRESS_ASSERT(warmP95For("get") <= 10.0, "Warm p95 for `get` exceeded 10ms");
+    REGRESS_ASSERT(warmP95For("add") <= 20.0, "Warm p95 for `add` exceeded 20ms");
+    REGRESS_ASSERT(warmP95For("sub") <= 20.0, "Warm p95 for `sub` exceeded 20ms");
     REGRESS_ASSERT(warmP95For("reset target") <= 250.0, "Warm p95 for `reset <target>` exceeded 250ms");
     REGRESS_ASSERT(warmP95For("list blue") <= 140.0, "Warm p95 for `list blue` exceeded 140ms");
     REGRESS_ASSERT(warmP95For("stats") <= 140.0, "Warm p95 for `stats` exceeded 140ms");
+
+    // Autocomplete runs on every keystroke, so each lookup has to stay well below a frame.
+    std::vector<double> completionUs;
+    completionUs.reserve(static_cast<size_t>(slug.length()) * 20);
+    for (int pass = 0; pass < 20; ++pass)
+    {
+        for (int length = 1; length <= slug.length(); ++length)
+        {
+            const auto t0 = Clock::now();
+            const auto matches = console->getAutocompleteMatchesForTesting("set " + slug.substring(0, length));
+            completionUs.push_back(static_cast<double>(
+                std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - t0).count()));
+            REGRESS_ASSERT(!matches.isEmpty(), "Autocomplete should match a known slug prefix");
+        }
+    }
+    const double completionP95Ms = percentile(completionUs, 95.0) / 1000.0;
+    std::cout << "Autocomplete p95: " << completionP95Ms << " ms over " << completionUs.size() << " queries\n";
+    REGRESS_ASSERT(completionP95Ms <= 1.0, "Autocomplete p95 exceeded 1ms");
+
+    // A scripted run of thousands of commands should cost milliseconds, not seconds.
+    constexpr int scriptCommands = 2000;
+    juce::StringArray scriptLines;
+    for (int i = 0; i < scriptCommands; ++i)
+        scriptLines.add((i % 2 == 0) ? ("set " + slug + " " + juce::String(0.25 + 0.5 * (i % 7) / 7.0, 4))
+                                     : ("get " + slug));
+    const auto scriptFile = juce::File::createTempFile(".choroscript");
+    scriptFile.replaceWithText(scriptLines.joinIntoString("\n"));
+    const auto scriptStart = Clock::now();
+    const auto importResult = console->submitCommandForTesting("import script " + scriptFile.getFullPathName(), false);
+    const double scriptMs = std::chrono::duration<double, std::milli>(Clock::now() - scriptStart).count();
+    scriptFile.deleteFile();
+    std::cout << "Scripted run: " << scriptCommands << " commands in " << scriptMs << " ms\n";
+    REGRESS_ASSERT(importResult.output.contains("applied=" + juce::String(scriptCommands) + ", failed=0"),
+                   "Scripted console run should apply every command");
+    REGRESS_ASSERT(scriptMs <= 400.0, "Scripted run of 2000 console commands exceeded 400ms");
 }
 
 int main(int argc, char** argv)
 {
     bool runGuiSuite = true;
+    bool rewriteAutocompleteDoc = false;
     for (int i = 1; i < argc; ++i)
     {
         const juce::String arg(argv[i] != nullptr ? argv[i] : "");
@@ -497,11 +1328,14 @@ int main(int argc, char** argv)
             runGuiSuite = false;
         else if (arg == "--gui")
             runGuiSuite = true;
+        else if (arg == "--write-autocomplete-json")
+            rewriteAutocompleteDoc = true;
         else if (arg == "--help" || arg == "-h")
         {
-            std::cout << "Usage: ChoroborosRegressionTests [--dsp-only] [--gui]\n";
+            std::cout << "Usage: ChoroborosRegressionTests [--dsp-only] [--gui] [--write-autocomplete-json]\n";
             std::cout << "  --dsp-only  Skip GUI-dependent regression suite (CI-safe on headless runners)\n";
             std::cout << "  --gui       Force full suite (default)\n";
+            std::cout << "  --write-autocomplete-json  Regenerate docs/CONSOLE_AUTOCOMPLETE.json instead of checking it\n";
             return 0;
         }
     }
@@ -515,8 +1349,29 @@ int main(int argc, char** argv)
     testEngineHQTorture();
     testStateRoundTrip();
     testMaxBlockChannels();
+    testOfflineChannelParallelMatchesSerial();
+    testQualityGovernorHysteresis();
+    testLatencyHistogramPercentiles();
+    testParameterRampsRunOnAudioThread();
+    testBlockRampsMatchSmoothedValue();
+    testDspArenaReprepare();
+    testSharedHistoryCoreSwitchSkipsWarmup();
+    testDspTablesSharedAcrossInstances();
+    testSurroundBedLfoSpread();
+    testSpreadLfosFollowOffsetRamp();
+    testApproxBbdMatchesStageModelSpectrum();
+    testApproxBbdCheaperAcrossClockRange();
+    testAnalyzerDemandReferenceCounting();
+    testParsedDefaultsCacheShared();
+    testSpriteBundleLayout();
+    testConsoleCompletionIndexRanking();
     if (runGuiSuite)
+    {
+        testAnimationDriverIdlesAtRest();
+        testDevPanelRowRecycling();
+        testConsoleAutocompleteDocMatchesBuilder(rewriteAutocompleteDoc);
         testConsoleCommandLatencyUnderAudioLoad();
+    }
     else
         std::cout << "Skipping GUI-dependent console latency suite (--dsp-only)\n";
 
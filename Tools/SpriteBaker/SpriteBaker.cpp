@@ -0,0 +1,221 @@
+/*
+ * Choroboros - A chorus that eats its own tail
+ * Copyright (C) 2026 Kaizen Strategic AI Inc.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Build-time tool: slices a knob spritesheet PNG into premultiplied raw frames at the size the
+// editor draws them and writes a SpriteBundle blob (see Source/UI/SpriteBundle.h).
+//
+// Usage: ChoroborosSpriteBaker <input.png> <output.sprites>
+//            --grid <cols>x<rows> --frame <px> --padding <px|auto>
+//            --draw-size <layout px> --ui-scale <editor scale> --bake-scale <pixel density>
+
+#include <juce_graphics/juce_graphics.h>
+#include "../../Source/UI/SpriteBundle.h"
+#include <iostream>
+
+namespace
+{
+struct BakeOptions
+{
+    juce::File input;
+    juce::File output;
+    int columns = 13;
+    int rows = 12;
+    int frameSize = 512;
+    int padding = 12; // < 0 = derive from sheet width
+    int drawSize = 0;
+    double uiScale = 1.0;
+    double bakeScale = 1.0;
+};
+
+bool parseOptions(const juce::StringArray& args, BakeOptions& options)
+{
+    if (args.size() < 2)
+        return false;
+
+    options.input = juce::File::getCurrentWorkingDirectory().getChildFile(args[0]);
+    options.output = juce::File::getCurrentWorkingDirectory().getChildFile(args[1]);
+    for (int i = 2; i + 1 < args.size(); i += 2)
+    {
+        const auto& key = args[i];
+        const auto& value = args[i + 1];
+        if (key == "--grid")
+        {
+            options.columns = value.upToFirstOccurrenceOf("x", false, false).getIntValue();
+            options.rows = value.fromFirstOccurrenceOf("x", false, false).getIntValue();
+        }
+        else if (key == "--frame")
+            options.frameSize = value.getIntValue();
+        else if (key == "--padding")
+            options.padding = value == "auto" ? -1 : value.getIntValue();
+        else if (key == "--draw-size")
+            options.drawSize = value.getIntValue();
+        else if (key == "--ui-scale")
+            options.uiScale = value.getDoubleValue();
+        else if (key == "--bake-scale")
+            options.bakeScale = value.getDoubleValue();
+        else
+            return false;
+    }
+    return options.columns > 0 && options.rows > 0 && options.frameSize > 0
+        && options.drawSize > 0 && options.uiScale > 0.0 && options.bakeScale > 0.0;
+}
+
+// Same fix-up the runtime PNG path applies: sheets exported at <100% opacity become opaque.
+void makeFullyOpaqueIfTranslucent(juce::Image& sheet)
+{
+    if (sheet.getFormat() != juce::Image::ARGB)
+        return;
+    const int sampleX = juce::jmin(192, sheet.getWidth() - 1);
+    const int sampleY = juce::jmin(192, sheet.getHeight() - 1);
+    const auto alpha = sheet.getPixelAt(sampleX, sampleY).getAlpha();
+    if (alpha == 0 || alpha == 255)
+        return;
+
+    juce::Image::BitmapData bitmap(sheet, juce::Image::BitmapData::readWrite);
+    for (int y = 0; y < bitmap.height; ++y)
+    {
+        auto* p = reinterpret_cast<juce::PixelARGB*>(bitmap.getLinePointer(y));
+        for (int x = 0; x < bitmap.width; ++x)
+        {
+            if (p[x].getAlpha() > 0)
+            {
+                p[x].unpremultiply();
+                p[x].setAlpha(255);
+                p[x].premultiply();
+            }
+        }
+    }
+}
+
+// 2x2 box filter on premultiplied pixels; repeated halving keeps thin highlights intact
+// before the final resample.
+juce::Image halve(const juce::Image& source)
+{
+    const int width = juce::jmax(1, source.getWidth() / 2);
+    const int height = juce::jmax(1, source.getHeight() / 2);
+    juce::Image result(juce::Image::ARGB, width, height, false);
+    const juce::Image::BitmapData src(source, juce::Image::BitmapData::readOnly);
+    const juce::Image::BitmapData dst(result, juce::Image::BitmapData::writeOnly);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            std::uint32_t sum[4] {};
+            for (int dy = 0; dy < 2; ++dy)
+            {
+                for (int dx = 0; dx < 2; ++dx)
+                {
+                    const auto* p = src.getPixelPointer(juce::jmin(src.width - 1, x * 2 + dx),
+                                                        juce::jmin(src.height - 1, y * 2 + dy));
+                    for (int c = 0; c < 4; ++c)
+                        sum[c] += p[c];
+                }
+            }
+            auto* out = dst.getPixelPointer(x, y);
+            for (int c = 0; c < 4; ++c)
+                out[c] = static_cast<juce::uint8>((sum[c] + 2u) / 4u);
+        }
+    }
+    return result;
+}
+
+juce::Image resizeFrame(juce::Image frame, int targetSize)
+{
+    while (frame.getWidth() >= targetSize * 2)
+        frame = halve(frame);
+    if (frame.getWidth() == targetSize && frame.getHeight() == targetSize)
+        return frame.convertedToFormat(juce::Image::ARGB);
+    return frame.convertedToFormat(juce::Image::ARGB)
+        .rescaled(targetSize, targetSize, juce::Graphics::highResamplingQuality);
+}
+
+void appendU32(juce::MemoryOutputStream& out, std::uint32_t value)
+{
+    out.writeInt(static_cast<int>(value)); // MemoryOutputStream writes little-endian
+}
+
+int bake(const BakeOptions& options)
+{
+    auto sheet = juce::ImageFileFormat::loadFrom(options.input);
+    if (!sheet.isValid())
+    {
+        std::cerr << "SpriteBaker: cannot decode " << options.input.getFullPathName() << "\n";
+        return 1;
+    }
+    sheet = sheet.convertedToFormat(juce::Image::ARGB);
+    makeFullyOpaqueIfTranslucent(sheet);
+
+    const int padding = options.padding >= 0
+        ? options.padding
+        : juce::jmax(0, (sheet.getWidth() - options.columns * options.frameSize) / (options.columns + 1));
+    const int step = options.frameSize + padding;
+    const int numFrames = options.columns * options.rows;
+    const int targetSize = juce::jmax(1, juce::roundToInt(options.drawSize * options.uiScale * options.bakeScale));
+    const auto lineStride = static_cast<std::uint32_t>(targetSize) * 4u;
+
+    juce::MemoryOutputStream out;
+    appendU32(out, SpriteBundle::kMagic);
+    appendU32(out, static_cast<std::uint32_t>(SpriteBundle::kVersion) | (4u << 16));
+    appendU32(out, static_cast<std::uint32_t>(numFrames));
+    appendU32(out, static_cast<std::uint32_t>(targetSize));
+    appendU32(out, static_cast<std::uint32_t>(targetSize));
+    appendU32(out, lineStride);
+    out.writeFloat(static_cast<float>(options.bakeScale));
+    appendU32(out, static_cast<std::uint32_t>(SpriteBundle::kHeaderSize));
+
+    const juce::Rectangle<int> sheetBounds(0, 0, sheet.getWidth(), sheet.getHeight());
+    for (int index = 0; index < numFrames; ++index)
+    {
+        const int col = index % options.columns;
+        const int row = index / options.columns;
+        const juce::Rectangle<int> src(padding + col * step, padding + row * step, options.frameSize, options.frameSize);
+        const auto clip = src.getIntersection(sheetBounds);
+        juce::Image frame(juce::Image::ARGB, targetSize, targetSize, true);
+        if (!clip.isEmpty())
+            frame = resizeFrame(sheet.getClippedImage(clip).createCopy(), targetSize);
+
+        const juce::Image::BitmapData bitmap(frame, juce::Image::BitmapData::readOnly);
+        for (int y = 0; y < targetSize; ++y)
+            out.write(bitmap.getLinePointer(y), lineStride);
+    }
+
+    options.output.getParentDirectory().createDirectory();
+    if (!options.output.replaceWithData(out.getData(), out.getDataSize()))
+    {
+        std::cerr << "SpriteBaker: cannot write " << options.output.getFullPathName() << "\n";
+        return 1;
+    }
+    return 0;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    juce::StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add(juce::String::fromUTF8(argv[i]));
+
+    BakeOptions options;
+    if (!parseOptions(args, options))
+    {
+        std::cerr << "Usage: ChoroborosSpriteBaker <input.png> <output.sprites> --grid <cols>x<rows> "
+                     "--frame <px> --padding <px|auto> --draw-size <px> --ui-scale <s> --bake-scale <s>\n";
+        return 2;
+    }
+    return bake(options);
+}